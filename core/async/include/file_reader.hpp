@@ -0,0 +1,152 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file file_reader.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <memory>
+
+// Tyl
+#include <tyl/expected.hpp>
+
+namespace tyl::async
+{
+
+/**
+ * @brief Error code indicating problems with reading a file
+ */
+enum class FileReadError
+{
+  kFailedToOpen,
+  kFailedToRead,
+};
+
+/**
+ * @brief Options for FileReader
+ */
+struct FileReaderOptions
+{
+  /// Maximum number of reads in flight at once
+  std::size_t queue_depth = 64;
+  /// Maximum number of completed buffers kept for reuse
+  std::size_t pooled_buffer_count = 64;
+  /// Uses io_uring, when supported by the system; reads are otherwise made with pread from up to queue_depth threads,
+  /// and no more than the number of hardware threads
+  bool enable_io_uring = true;
+};
+
+class FileReadBufferPool;
+
+/**
+ * @brief Contents of a file read by a FileReader
+ *
+ *        Storage is returned to the reader which produced it on destruction, to be reused by later reads.
+ */
+class FileReadBuffer
+{
+public:
+  FileReadBuffer() = default;
+
+  FileReadBuffer(FileReadBuffer&& other);
+
+  FileReadBuffer& operator=(FileReadBuffer&& other);
+
+  ~FileReadBuffer();
+
+  /**
+   * @brief Returns pointer to file contents
+   */
+  [[nodiscard]] const std::uint8_t* data() const { return bytes_.get(); }
+
+  /**
+   * @brief Returns size of file contents, in bytes
+   */
+  [[nodiscard]] std::size_t size() const { return size_; }
+
+  /**
+   * @brief Returns true if file was empty
+   */
+  [[nodiscard]] bool empty() const { return size_ == 0; }
+
+private:
+  friend class FileReadBufferPool;
+
+  FileReadBuffer(
+    std::unique_ptr<std::uint8_t[]> bytes,
+    std::size_t size,
+    std::size_t capacity,
+    std::weak_ptr<FileReadBufferPool> pool);
+
+  /// Returns storage to the pool, if it still exists
+  void release();
+
+  /// File contents
+  std::unique_ptr<std::uint8_t[]> bytes_;
+
+  /// Size of file contents, in bytes
+  std::size_t size_ = 0;
+
+  /// Size of bytes_ allocation, in bytes
+  std::size_t capacity_ = 0;
+
+  /// Pool to which storage is returned
+  std::weak_ptr<FileReadBufferPool> pool_;
+};
+
+/**
+ * @brief Reads whole files into pooled memory buffers in the background
+ *
+ *        Many reads are kept in flight at once, independently of any thread pool, so that decoding of file contents
+ *        can happen afterwards from memory. Reads are batched through io_uring where the system allows it, and made
+ *        with pread from a set of dedicated threads otherwise.
+ */
+class FileReader
+{
+public:
+  using Result = expected<FileReadBuffer, FileReadError>;
+
+  explicit FileReader(const FileReaderOptions& options = {});
+
+  FileReader(FileReader&& other);
+
+  FileReader& operator=(FileReader&& other);
+
+  /**
+   * @brief Finishes all requested reads before returning
+   */
+  ~FileReader();
+
+  /**
+   * @brief Requests that the whole contents of a file be read
+   *
+   * @return future set with file contents once read
+   */
+  [[nodiscard]] std::future<Result> read(const std::filesystem::path& path);
+
+  /**
+   * @brief Requests that the whole contents of a file be read, and calls \c on_read with them once read
+   *
+   * @note \c on_read is called from a reader thread, and should hand off any lengthy work rather than do it there
+   */
+  void read(const std::filesystem::path& path, std::function<void(Result)> on_read);
+
+  /**
+   * @brief Returns true if reads are made through io_uring
+   */
+  [[nodiscard]] bool uses_io_uring() const;
+
+private:
+  struct Impl;
+
+  /// Reader state, shared with its service threads
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace tyl::async
@@ -0,0 +1,218 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file job_system.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace tyl::async
+{
+
+/**
+ * @brief Options for JobSystem
+ */
+struct JobSystemOptions
+{
+  /// Number of worker threads; threads which wait on a TaskGroup also run jobs, so this may be zero
+  std::size_t worker_count = std::max<std::size_t>(1, std::thread::hardware_concurrency()) - 1;
+};
+
+/**
+ * @brief Unit of work run by a JobSystem
+ *
+ * @note jobs must not throw
+ */
+using Job = std::function<void()>;
+
+/**
+ * @brief Runs jobs on a fixed set of worker threads, which steal work from each other when they run out
+ *
+ *        Each worker keeps its own queue of jobs. Jobs submitted from a worker go to that worker's queue, and are run
+ *        most-recent first, which keeps recursively split work local to one thread. Idle workers take the oldest jobs
+ *        from other queues. Jobs submitted from other threads are shared by all workers.
+ */
+class JobSystem
+{
+public:
+  explicit JobSystem(const JobSystemOptions& options = {});
+
+  JobSystem(JobSystem&& other) = delete;
+
+  JobSystem& operator=(JobSystem&& other) = delete;
+
+  /**
+   * @brief Finishes all submitted jobs before returning
+   */
+  ~JobSystem();
+
+  /**
+   * @brief Queues a job to run on some worker
+   */
+  void submit(Job job);
+
+  /**
+   * @brief Runs one queued job on the calling thread
+   *
+   * @return true if a job was run
+   */
+  bool try_run_one();
+
+  /**
+   * @brief Returns number of worker threads
+   */
+  [[nodiscard]] std::size_t worker_count() const;
+
+private:
+  struct Impl;
+
+  /// Queues and workers, shared with worker threads
+  std::unique_ptr<Impl> impl_;
+};
+
+/**
+ * @brief Set of jobs which may be waited on together (fork/join)
+ *
+ *        Jobs in a group may add more jobs to the same group. Continuations added with \c then run once every job in
+ *        the group has finished.
+ */
+class TaskGroup
+{
+public:
+  explicit TaskGroup(JobSystem& jobs);
+
+  TaskGroup(TaskGroup&& other) = delete;
+
+  TaskGroup& operator=(TaskGroup&& other) = delete;
+
+  /**
+   * @brief Waits on all jobs in the group before returning
+   */
+  ~TaskGroup();
+
+  /**
+   * @brief Adds a job to the group
+   */
+  template <typename WorkT> void run(WorkT&& work)
+  {
+    state_->pending.fetch_add(1, std::memory_order_relaxed);
+    jobs_->submit([state = state_, work = std::forward<WorkT>(work)]() mutable {
+      work();
+      finish(*state);
+    });
+  }
+
+  /**
+   * @brief Adds a job to run once all jobs currently in the group have finished, without blocking
+   *
+   *        Runs immediately on the calling thread if the group is already idle.
+   */
+  void then(Job continuation);
+
+  /**
+   * @brief Blocks until all jobs in the group have finished, running queued jobs in the meantime
+   */
+  void wait();
+
+  /**
+   * @brief Returns true if all jobs in the group have finished
+   */
+  [[nodiscard]] bool done() const { return state_->pending.load(std::memory_order_acquire) == 0; }
+
+private:
+  struct State
+  {
+    /// System to which jobs are submitted
+    JobSystem* jobs;
+    /// Number of unfinished jobs
+    std::atomic<std::size_t> pending = 0;
+    /// Guards continuations
+    std::mutex continuations_mutex;
+    /// Jobs to submit once pending reaches zero
+    std::vector<Job> continuations;
+  };
+
+  /// Marks a job as finished, and submits continuations if it was the last one
+  static void finish(State& state);
+
+  /// Job system to which jobs are submitted
+  JobSystem* jobs_;
+
+  /// Shared with running jobs, so that they never refer to a destroyed group
+  std::shared_ptr<State> state_;
+};
+
+/**
+ * @brief Calls \c fn on every element of \c range, in parallel, and returns once all calls have finished
+ *
+ *        Elements are split into chunks of up to \c grain elements, each run as one job. Works with any range which
+ *        provides begin and end, including EnTT views and groups, in which case \c fn is called with each entity.
+ *        Random-access ranges are split by index; other ranges (e.g. multi-component views) have their iterators
+ *        gathered while chunking, on the calling thread.
+ *
+ * @note \c fn is called concurrently, and must only modify what belongs to the element it is given
+ */
+template <typename RangeT, typename FnT>
+void parallel_for_each(JobSystem& jobs, RangeT&& range, FnT&& fn, const std::size_t grain = 64)
+{
+  using std::begin;
+  using std::end;
+  using IteratorT = decltype(begin(range));
+  using CategoryT = typename std::iterator_traits<IteratorT>::iterator_category;
+
+  const std::size_t chunk_size = std::max<std::size_t>(1, grain);
+  TaskGroup group{jobs};
+  if constexpr (std::is_base_of_v<std::random_access_iterator_tag, CategoryT>)
+  {
+    const auto first = begin(range);
+    const auto size = static_cast<std::size_t>(std::distance(first, end(range)));
+    for (std::size_t offset = 0; offset < size; offset += chunk_size)
+    {
+      const auto chunk_first = std::next(first, offset);
+      const auto chunk_last = std::next(chunk_first, std::min(chunk_size, size - offset));
+      group.run([&fn, chunk_first, chunk_last] { std::for_each(chunk_first, chunk_last, fn); });
+    }
+  }
+  else
+  {
+    std::vector<IteratorT> chunk;
+    chunk.reserve(chunk_size);
+    const auto run_chunk = [&group, &fn](std::vector<IteratorT>&& iterators) {
+      group.run([&fn, iterators = std::move(iterators)] {
+        for (const auto& itr : iterators)
+        {
+          fn(*itr);
+        }
+      });
+    };
+    for (auto itr = begin(range), last = end(range); itr != last; ++itr)
+    {
+      chunk.push_back(itr);
+      if (chunk.size() == chunk_size)
+      {
+        run_chunk(std::move(chunk));
+        chunk = {};
+        chunk.reserve(chunk_size);
+      }
+    }
+    if (!chunk.empty())
+    {
+      run_chunk(std::move(chunk));
+    }
+  }
+  group.wait();
+}
+
+}  // namespace tyl::async
@@ -0,0 +1,92 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file main_thread_queue.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+
+namespace tyl::async
+{
+
+/**
+ * @brief Queue of work to run on one particular thread, usually the main thread
+ *
+ *        Used for work which must happen on the thread which owns some context, like uploading textures to a graphics
+ *        device, once background work has finished. Any thread may post work without locking (multi-producer); only
+ *        the owning thread may drain it (single-consumer).
+ */
+class MainThreadQueue
+{
+public:
+  using Task = std::function<void()>;
+
+  using Duration = std::chrono::steady_clock::duration;
+
+  MainThreadQueue();
+
+  MainThreadQueue(MainThreadQueue&& other) = delete;
+
+  MainThreadQueue& operator=(MainThreadQueue&& other) = delete;
+
+  /**
+   * @brief Runs any work which is still queued, on the destroying thread
+   *
+   * @note anything queued work refers to must outlive the queue
+   */
+  ~MainThreadQueue();
+
+  /**
+   * @brief Queues work to run on the next drain; may be called from any thread
+   */
+  void post(Task task);
+
+  /**
+   * @brief Runs queued work, in the order it was posted, until none is left
+   *
+   * @return number of tasks run
+   */
+  std::size_t drain();
+
+  /**
+   * @brief Runs queued work, in the order it was posted, until none is left or \c budget has been spent
+   *
+   *        At least one task is run, if any are queued, so that progress is made even with a tiny budget. Tasks are
+   *        never interrupted, so the budget may be overrun by the length of the last task run.
+   *
+   * @return number of tasks run
+   */
+  std::size_t drain(Duration budget);
+
+  /**
+   * @brief Returns true if no work is queued; may only be called from the draining thread
+   *
+   * @note work which is in the middle of being posted may not be seen
+   */
+  [[nodiscard]] bool empty() const;
+
+private:
+  struct Node
+  {
+    /// Next node, in posting order
+    std::atomic<Node*> next = nullptr;
+    /// Work to run; empty for the node which tail_ points to
+    Task task;
+  };
+
+  /// Takes the oldest task, or returns false if none are ready
+  bool pop(Task& task);
+
+  /// Most recently posted node; exchanged by posting threads
+  std::atomic<Node*> head_;
+
+  /// Node before the oldest task; only touched by the draining thread
+  Node* tail_;
+};
+
+}  // namespace tyl::async
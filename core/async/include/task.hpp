@@ -0,0 +1,363 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file task.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+// Tyl
+#include <tyl/async/file_reader.hpp>
+#include <tyl/async/job_system.hpp>
+#include <tyl/async/main_thread_queue.hpp>
+
+namespace tyl::async
+{
+
+template <typename T = void> class Task;
+
+namespace detail
+{
+
+/**
+ * @brief State shared by all Task promises
+ */
+class TaskPromiseBase
+{
+public:
+  /**
+   * @brief Resumes whichever coroutine awaited the task, once it finishes
+   */
+  struct FinalAwaiter
+  {
+    bool await_ready() const noexcept { return false; }
+
+    template <typename PromiseT> std::coroutine_handle<> await_suspend(std::coroutine_handle<PromiseT> handle) noexcept
+    {
+      return handle.promise().continuation_;
+    }
+
+    void await_resume() const noexcept {}
+  };
+
+  std::suspend_always initial_suspend() const noexcept { return {}; }
+
+  FinalAwaiter final_suspend() const noexcept { return {}; }
+
+  void unhandled_exception() { exception_ = std::current_exception(); }
+
+  void set_continuation(const std::coroutine_handle<> continuation) { continuation_ = continuation; }
+
+  void rethrow_if_exception() const
+  {
+    if (exception_)
+    {
+      std::rethrow_exception(exception_);
+    }
+  }
+
+private:
+  /// Coroutine to resume once this one finishes
+  std::coroutine_handle<> continuation_ = std::noop_coroutine();
+
+  /// Exception thrown from the task body, rethrown to whichever coroutine awaits it
+  std::exception_ptr exception_;
+};
+
+template <typename T> class TaskPromise final : public TaskPromiseBase
+{
+public:
+  Task<T> get_return_object();
+
+  template <typename U> void return_value(U&& value) { value_.emplace(std::forward<U>(value)); }
+
+  T take()
+  {
+    rethrow_if_exception();
+    return std::move(*value_);
+  }
+
+private:
+  /// Value produced by the task
+  std::optional<T> value_;
+};
+
+template <> class TaskPromise<void> final : public TaskPromiseBase
+{
+public:
+  Task<void> get_return_object();
+
+  void return_void() const {}
+
+  void take() const { rethrow_if_exception(); }
+};
+
+}  // namespace detail
+
+/**
+ * @brief Lazily-started coroutine which produces a value of type T
+ *
+ *        A task starts running when it is awaited, on the thread which awaits it, and resumes its awaiter on whichever
+ *        thread it finishes on. Use schedule_on to move a task between the JobSystem and the MainThreadQueue.
+ *
+ * @code{.cpp}
+ *        Task<Image> load(FileReader& reader, JobSystem& jobs, const std::filesystem::path& path)
+ *        {
+ *          auto contents = co_await read_file(reader, path, jobs);
+ *          co_return Image::load(contents->data(), contents->size());
+ *        }
+ * @endcode
+ */
+template <typename T> class [[nodiscard]] Task
+{
+public:
+  using promise_type = detail::TaskPromise<T>;
+
+  Task(Task&& other) : handle_{std::exchange(other.handle_, nullptr)} {}
+
+  Task& operator=(Task&& other)
+  {
+    if (this != std::addressof(other))
+    {
+      reset();
+      handle_ = std::exchange(other.handle_, nullptr);
+    }
+    return *this;
+  }
+
+  ~Task() { reset(); }
+
+  /**
+   * @brief Starts the task and suspends the awaiting coroutine until the task finishes
+   */
+  auto operator co_await() && noexcept
+  {
+    struct Awaiter
+    {
+      std::coroutine_handle<promise_type> handle;
+
+      bool await_ready() const noexcept { return false; }
+
+      std::coroutine_handle<> await_suspend(const std::coroutine_handle<> awaiting) noexcept
+      {
+        handle.promise().set_continuation(awaiting);
+        return handle;
+      }
+
+      T await_resume() { return handle.promise().take(); }
+    };
+    return Awaiter{handle_};
+  }
+
+private:
+  friend class detail::TaskPromise<T>;
+
+  explicit Task(const std::coroutine_handle<promise_type> handle) : handle_{handle} {}
+
+  void reset()
+  {
+    if (handle_)
+    {
+      handle_.destroy();
+      handle_ = nullptr;
+    }
+  }
+
+  /// Coroutine frame, owned by this task
+  std::coroutine_handle<promise_type> handle_;
+};
+
+namespace detail
+{
+
+template <typename T> Task<T> TaskPromise<T>::get_return_object()
+{
+  return Task<T>{std::coroutine_handle<TaskPromise<T>>::from_promise(*this)};
+}
+
+inline Task<void> TaskPromise<void>::get_return_object()
+{
+  return Task<void>{std::coroutine_handle<TaskPromise<void>>::from_promise(*this)};
+}
+
+/**
+ * @brief Coroutine which starts immediately and frees itself when done
+ */
+struct DetachedTask
+{
+  struct promise_type
+  {
+    DetachedTask get_return_object() const noexcept { return {}; }
+
+    std::suspend_never initial_suspend() const noexcept { return {}; }
+
+    std::suspend_never final_suspend() const noexcept { return {}; }
+
+    void return_void() const noexcept {}
+
+    [[noreturn]] void unhandled_exception() const noexcept { std::terminate(); }
+  };
+};
+
+inline DetachedTask run_detached(Task<void> task) { co_await std::move(task); }
+
+inline void resume_on(JobSystem& jobs, const std::coroutine_handle<> handle)
+{
+  jobs.submit([handle] { handle.resume(); });
+}
+
+inline void resume_on(MainThreadQueue& queue, const std::coroutine_handle<> handle)
+{
+  queue.post([handle] { handle.resume(); });
+}
+
+}  // namespace detail
+
+/**
+ * @brief Starts a task without waiting on it; the task frees itself once finished
+ *
+ * @note the task must not throw
+ */
+inline void spawn(Task<void> task) { detail::run_detached(std::move(task)); }
+
+namespace detail
+{
+
+/**
+ * @brief Result of a task being waited on by sync_wait
+ */
+template <typename T> struct SyncWaitState
+{
+  std::mutex mutex;
+  std::condition_variable cv;
+  bool done = false;
+  std::optional<std::conditional_t<std::is_void_v<T>, bool, T>> result;
+  std::exception_ptr exception;
+};
+
+template <typename T> Task<void> sync_wait_impl(Task<T> task, SyncWaitState<T>& state)
+{
+  try
+  {
+    if constexpr (std::is_void_v<T>)
+    {
+      co_await std::move(task);
+    }
+    else
+    {
+      state.result.emplace(co_await std::move(task));
+    }
+  }
+  catch (...)
+  {
+    state.exception = std::current_exception();
+  }
+  // Notified while locked, so that the waiting thread cannot destroy state before this is done with it
+  std::lock_guard lock{state.mutex};
+  state.done = true;
+  state.cv.notify_one();
+}
+
+}  // namespace detail
+
+/**
+ * @brief Blocks until a task has finished, and returns its result
+ *
+ * @warning deadlocks if the task needs to resume on the calling thread, e.g. through the MainThreadQueue it drains
+ */
+template <typename T> T sync_wait(Task<T> task)
+{
+  detail::SyncWaitState<T> state;
+  spawn(detail::sync_wait_impl(std::move(task), state));
+
+  std::unique_lock lock{state.mutex};
+  state.cv.wait(lock, [&state] { return state.done; });
+  if (state.exception)
+  {
+    std::rethrow_exception(state.exception);
+  }
+  if constexpr (!std::is_void_v<T>)
+  {
+    return std::move(*state.result);
+  }
+}
+
+/**
+ * @brief Awaitable which resumes the awaiting coroutine as a job on \c jobs
+ */
+inline auto schedule_on(JobSystem& jobs)
+{
+  struct Awaiter
+  {
+    JobSystem* jobs;
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(const std::coroutine_handle<> handle) const { detail::resume_on(*jobs, handle); }
+
+    void await_resume() const noexcept {}
+  };
+  return Awaiter{std::addressof(jobs)};
+}
+
+/**
+ * @brief Awaitable which resumes the awaiting coroutine on the thread which drains \c queue
+ *
+ *        Used to get back onto the main thread for graphics and audio device work, like texture uploads.
+ */
+inline auto schedule_on(MainThreadQueue& queue)
+{
+  struct Awaiter
+  {
+    MainThreadQueue* queue;
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(const std::coroutine_handle<> handle) const { detail::resume_on(*queue, handle); }
+
+    void await_resume() const noexcept {}
+  };
+  return Awaiter{std::addressof(queue)};
+}
+
+/**
+ * @brief Awaitable which reads a whole file through \c reader, then resumes the awaiting coroutine on \c scheduler
+ *
+ * @param scheduler  JobSystem or MainThreadQueue to resume on; reader threads are never used to run coroutines
+ */
+template <typename SchedulerT>
+auto read_file(FileReader& reader, std::filesystem::path path, SchedulerT& scheduler)
+{
+  struct Awaiter
+  {
+    FileReader* reader;
+    std::filesystem::path path;
+    SchedulerT* scheduler;
+    std::optional<FileReader::Result> result = std::nullopt;
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(const std::coroutine_handle<> handle)
+    {
+      // Nothing in this awaiter may be touched after the read is requested, since the coroutine may resume at once
+      reader->read(path, [this, handle](FileReader::Result read_result) {
+        result.emplace(std::move(read_result));
+        detail::resume_on(*scheduler, handle);
+      });
+    }
+
+    FileReader::Result await_resume() { return std::move(*result); }
+  };
+  return Awaiter{std::addressof(reader), std::move(path), std::addressof(scheduler)};
+}
+
+}  // namespace tyl::async
@@ -0,0 +1,836 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file file_reader.cpp
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Tyl
+#include <tyl/async/file_reader.hpp>
+
+// Linux
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace tyl::async
+{
+
+/**
+ * @brief Storage for file contents, kept for reuse once read contents are released
+ */
+class FileReadBufferPool : public std::enable_shared_from_this<FileReadBufferPool>
+{
+public:
+  /**
+   * @brief Uninitialized storage
+   */
+  struct Storage
+  {
+    /// Allocated bytes
+    std::unique_ptr<std::uint8_t[]> bytes;
+    /// Number of allocated bytes
+    std::size_t capacity = 0;
+  };
+
+  explicit FileReadBufferPool(const std::size_t max_free_count) : max_free_count_{max_free_count} {}
+
+  /**
+   * @brief Returns the smallest free storage which holds at least size bytes, or new storage if none are free
+   */
+  Storage acquire(const std::size_t size)
+  {
+    {
+      std::lock_guard lock{mutex_};
+      auto best = free_.end();
+      for (auto itr = free_.begin(); itr != free_.end(); ++itr)
+      {
+        if (itr->capacity >= size and (best == free_.end() or itr->capacity < best->capacity))
+        {
+          best = itr;
+        }
+      }
+
+      if (best != free_.end())
+      {
+        Storage storage = std::move(*best);
+        *best = std::move(free_.back());
+        free_.pop_back();
+        return storage;
+      }
+    }
+    // Contents are always overwritten by reads, so storage is left uninitialized
+    return Storage{std::unique_ptr<std::uint8_t[]>{new std::uint8_t[std::max<std::size_t>(size, 1)]}, size};
+  }
+
+  /**
+   * @brief Keeps storage for reuse; drops the smallest storage if the pool is full
+   */
+  void release(Storage&& storage)
+  {
+    std::lock_guard lock{mutex_};
+    free_.push_back(std::move(storage));
+    if (free_.size() > max_free_count_)
+    {
+      const auto smallest = std::min_element(
+        free_.begin(), free_.end(), [](const auto& lhs, const auto& rhs) { return lhs.capacity < rhs.capacity; });
+      *smallest = std::move(free_.back());
+      free_.pop_back();
+    }
+  }
+
+  /**
+   * @brief Wraps storage holding size bytes of file contents
+   */
+  FileReadBuffer make_buffer(Storage&& storage, const std::size_t size)
+  {
+    return FileReadBuffer{std::move(storage.bytes), size, storage.capacity, weak_from_this()};
+  }
+
+private:
+  /// Maximum number of storage kept for reuse
+  std::size_t max_free_count_;
+
+  /// Guards free_
+  std::mutex mutex_;
+
+  /// Storage available for reuse
+  std::vector<Storage> free_;
+};
+
+FileReadBuffer::FileReadBuffer(
+  std::unique_ptr<std::uint8_t[]> bytes,
+  const std::size_t size,
+  const std::size_t capacity,
+  std::weak_ptr<FileReadBufferPool> pool) :
+    bytes_{std::move(bytes)}, size_{size}, capacity_{capacity}, pool_{std::move(pool)}
+{}
+
+FileReadBuffer::FileReadBuffer(FileReadBuffer&& other) :
+    bytes_{std::move(other.bytes_)},
+    size_{std::exchange(other.size_, 0)},
+    capacity_{std::exchange(other.capacity_, 0)},
+    pool_{std::move(other.pool_)}
+{}
+
+FileReadBuffer& FileReadBuffer::operator=(FileReadBuffer&& other)
+{
+  if (this != std::addressof(other))
+  {
+    release();
+    bytes_ = std::move(other.bytes_);
+    size_ = std::exchange(other.size_, 0);
+    capacity_ = std::exchange(other.capacity_, 0);
+    pool_ = std::move(other.pool_);
+  }
+  return *this;
+}
+
+FileReadBuffer::~FileReadBuffer() { release(); }
+
+void FileReadBuffer::release()
+{
+  if (bytes_ == nullptr)
+  {
+    return;
+  }
+  else if (auto pool = pool_.lock(); pool != nullptr)
+  {
+    pool->release(FileReadBufferPool::Storage{std::move(bytes_), capacity_});
+  }
+  bytes_.reset();
+  size_ = 0;
+  capacity_ = 0;
+}
+
+namespace  // anonymous
+{
+
+/**
+ * @brief Minimal io_uring submission and completion rings, set up directly through system calls
+ */
+class IoUring
+{
+public:
+  /**
+   * @brief Sets up a ring with room for at least entries submissions, or returns nullptr if io_uring is unavailable
+   */
+  static std::unique_ptr<IoUring> create(const unsigned entries)
+  {
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+
+    const int ring_fd = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+    if (ring_fd < 0)
+    {
+      return nullptr;
+    }
+
+    auto ring = std::unique_ptr<IoUring>{new IoUring{ring_fd, params}};
+    if (ring->sq_ring_ == MAP_FAILED or ring->cq_ring_ == MAP_FAILED or ring->sqes_ == MAP_FAILED)
+    {
+      return nullptr;
+    }
+    return ring;
+  }
+
+  ~IoUring()
+  {
+    if (sqes_ != MAP_FAILED)
+    {
+      ::munmap(sqes_, sqes_size_);
+    }
+    if (cq_ring_ != MAP_FAILED and cq_ring_ != sq_ring_)
+    {
+      ::munmap(cq_ring_, cq_ring_size_);
+    }
+    if (sq_ring_ != MAP_FAILED)
+    {
+      ::munmap(sq_ring_, sq_ring_size_);
+    }
+    ::close(ring_fd_);
+  }
+
+  /**
+   * @brief Returns true if files may be opened and stat-ed through the ring, which needs a newer kernel than reads
+   */
+  [[nodiscard]] bool supports_open_and_stat() const { return supports_open_and_stat_; }
+
+  /**
+   * @brief Queues a vectored read of a single buffer
+   *
+   * @warning caller must not queue more submissions than the ring was created with before calling submit
+   */
+  void prepare_read(const int fd, const iovec* iov, const std::uint64_t offset, const std::uint64_t user_data)
+  {
+    io_uring_sqe* sqe = IoUring::start_sqe(IORING_OP_READV, fd, user_data);
+    sqe->addr = reinterpret_cast<std::uint64_t>(iov);
+    sqe->len = 1;
+    sqe->off = offset;
+    IoUring::queue_sqe();
+  }
+
+  /**
+   * @brief Queues opening of a file for reading; completes with the new file descriptor
+   *
+   * @warning path must stay valid until the open completes
+   */
+  void prepare_open(const char* path, const std::uint64_t user_data)
+  {
+    io_uring_sqe* sqe = IoUring::start_sqe(IORING_OP_OPENAT, AT_FDCWD, user_data);
+    sqe->addr = reinterpret_cast<std::uint64_t>(path);
+    sqe->open_flags = O_RDONLY | O_CLOEXEC;
+    IoUring::queue_sqe();
+  }
+
+  /**
+   * @brief Queues a query of the size of a file
+   *
+   * @warning path and stx must stay valid until the query completes
+   */
+  void prepare_stat(const char* path, struct statx* stx, const std::uint64_t user_data)
+  {
+    io_uring_sqe* sqe = IoUring::start_sqe(IORING_OP_STATX, AT_FDCWD, user_data);
+    sqe->addr = reinterpret_cast<std::uint64_t>(path);
+    sqe->len = STATX_SIZE;
+    sqe->off = reinterpret_cast<std::uint64_t>(stx);
+    IoUring::queue_sqe();
+  }
+
+  /**
+   * @brief Submits queued reads and waits until at least one read completes
+   *
+   * @return false if the ring could not be entered
+   */
+  bool submit_and_wait()
+  {
+    while (true)
+    {
+      const int submitted = static_cast<int>(
+        ::syscall(__NR_io_uring_enter, ring_fd_, unsubmitted_, 1U, IORING_ENTER_GETEVENTS, nullptr, 0UL));
+      if (submitted >= 0)
+      {
+        unsubmitted_ -= static_cast<unsigned>(submitted);
+        return true;
+      }
+      else if (errno != EINTR)
+      {
+        return false;
+      }
+    }
+  }
+
+  /**
+   * @brief Invokes on_complete(user_data, result) for each completed read
+   */
+  template <typename OnCompleteT> void reap(OnCompleteT&& on_complete)
+  {
+    unsigned head = *cq_head_;
+    while (head != __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE))
+    {
+      const io_uring_cqe& cqe = cqes_[head & *cq_mask_];
+      const std::uint64_t user_data = cqe.user_data;
+      const int result = cqe.res;
+      ++head;
+      __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+      on_complete(user_data, result);
+    }
+  }
+
+private:
+  /**
+   * @brief Clears the next submission entry and fills in fields common to all operations
+   */
+  io_uring_sqe* start_sqe(const std::uint8_t opcode, const int fd, const std::uint64_t user_data)
+  {
+    io_uring_sqe* sqe = sqes_ + (*sq_tail_ & *sq_mask_);
+    std::memset(sqe, 0, sizeof(io_uring_sqe));
+    sqe->opcode = opcode;
+    sqe->fd = fd;
+    sqe->user_data = user_data;
+    return sqe;
+  }
+
+  /**
+   * @brief Adds the entry filled in since start_sqe to the submission ring
+   */
+  void queue_sqe()
+  {
+    const unsigned tail = *sq_tail_;
+    const unsigned index = tail & *sq_mask_;
+    sq_array_[index] = index;
+    __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+    ++unsubmitted_;
+  }
+
+  IoUring(const int ring_fd, const io_uring_params& params) : ring_fd_{ring_fd}
+  {
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+
+    const bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap)
+    {
+      sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+    }
+
+    sq_ring_ = ::mmap(
+      nullptr, sq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING);
+    cq_ring_ = single_mmap ? sq_ring_
+                           : ::mmap(
+                               nullptr,
+                               cq_ring_size_,
+                               PROT_READ | PROT_WRITE,
+                               MAP_SHARED | MAP_POPULATE,
+                               ring_fd_,
+                               IORING_OFF_CQ_RING);
+    sqes_ = static_cast<io_uring_sqe*>(
+      ::mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES));
+
+    if (sq_ring_ == MAP_FAILED or cq_ring_ == MAP_FAILED)
+    {
+      return;
+    }
+
+    auto* sq = static_cast<std::uint8_t*>(sq_ring_);
+    sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    sq_mask_ = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    sq_array_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+
+    auto* cq = static_cast<std::uint8_t*>(cq_ring_);
+    cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    cq_mask_ = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+    constexpr unsigned kProbeOpCount = 256;
+    std::vector<std::uint8_t> probe_storage(sizeof(io_uring_probe) + kProbeOpCount * sizeof(io_uring_probe_op));
+    auto* probe = reinterpret_cast<io_uring_probe*>(probe_storage.data());
+    if (::syscall(__NR_io_uring_register, ring_fd_, IORING_REGISTER_PROBE, probe, kProbeOpCount) == 0)
+    {
+      const auto supported = [probe](const unsigned op) {
+        return op <= probe->last_op and (probe->ops[op].flags & IO_URING_OP_SUPPORTED) != 0;
+      };
+      supports_open_and_stat_ = supported(IORING_OP_OPENAT) and supported(IORING_OP_STATX);
+    }
+  }
+
+  /// Ring file descriptor
+  int ring_fd_;
+
+  /// Number of queued submissions not yet handed to the kernel
+  unsigned unsubmitted_ = 0;
+
+  /// Set if the kernel supports IORING_OP_OPENAT and IORING_OP_STATX
+  bool supports_open_and_stat_ = false;
+
+  /// Mapped submission ring and its size
+  void* sq_ring_ = MAP_FAILED;
+  std::size_t sq_ring_size_ = 0;
+
+  /// Mapped completion ring and its size; may share a mapping with the submission ring
+  void* cq_ring_ = MAP_FAILED;
+  std::size_t cq_ring_size_ = 0;
+
+  /// Mapped submission entries and their size
+  io_uring_sqe* sqes_ = static_cast<io_uring_sqe*>(MAP_FAILED);
+  std::size_t sqes_size_ = 0;
+
+  /// Submission ring fields
+  unsigned* sq_tail_ = nullptr;
+  unsigned* sq_mask_ = nullptr;
+  unsigned* sq_array_ = nullptr;
+
+  /// Completion ring fields
+  unsigned* cq_head_ = nullptr;
+  unsigned* cq_tail_ = nullptr;
+  unsigned* cq_mask_ = nullptr;
+  io_uring_cqe* cqes_ = nullptr;
+};
+
+/**
+ * @brief Opens a file for reading and gets its size
+ */
+expected<std::pair<int, std::size_t>, FileReadError> open_for_read(const std::filesystem::path& path)
+{
+  const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0)
+  {
+    return make_unexpected(FileReadError::kFailedToOpen);
+  }
+
+  struct stat st;
+  if (::fstat(fd, &st) != 0)
+  {
+    ::close(fd);
+    return make_unexpected(FileReadError::kFailedToRead);
+  }
+  return std::make_pair(fd, static_cast<std::size_t>(st.st_size));
+}
+
+}  // namespace anonymous
+
+struct FileReader::Impl
+{
+  /**
+   * @brief Pending request to read a file
+   */
+  struct Request
+  {
+    /// Path to file
+    std::filesystem::path path;
+    /// Called once file is read, from a reader thread
+    std::function<void(Result)> on_read;
+  };
+
+  /**
+   * @brief Kind of operation in flight through io_uring, stored in the low bits of its user data
+   */
+  enum RingOp : std::uint64_t
+  {
+    kRingOpen = 0,
+    kRingStat = 1,
+    kRingRead = 2,
+  };
+
+  /// Number of low user data bits which hold a RingOp; the remaining bits hold a slot index
+  static constexpr std::uint64_t kRingOpBits = 2;
+
+  /**
+   * @brief Read which is in flight through io_uring
+   */
+  struct Slot
+  {
+    /// Request being served
+    Request request;
+    /// Number of open and stat operations which must complete before reading starts
+    int pending_ops = 0;
+    /// Set if opening or stat-ing the file failed
+    std::optional<FileReadError> error;
+    /// File status, filled in through the ring
+    struct statx stx;
+    /// Descriptor of file being read
+    int fd = -1;
+    /// Storage being read into
+    FileReadBufferPool::Storage storage;
+    /// Size of file
+    std::size_t size = 0;
+    /// Number of bytes read so far
+    std::size_t offset = 0;
+    /// Destination of the read in flight
+    iovec iov;
+  };
+
+  explicit Impl(const FileReaderOptions& options) :
+      queue_depth{std::max<std::size_t>(options.queue_depth, 1)},
+      pool{std::make_shared<FileReadBufferPool>(options.pooled_buffer_count)},
+      ring{options.enable_io_uring ? IoUring::create(static_cast<unsigned>(2 * queue_depth)) : nullptr}
+  {
+    if (ring == nullptr)
+    {
+      // Blocking reads gain little from more threads than the system can run at once
+      const std::size_t thread_count =
+        std::min<std::size_t>(queue_depth, std::max(1U, std::thread::hardware_concurrency()));
+      threads.reserve(thread_count);
+      for (std::size_t i = 0; i < thread_count; ++i)
+      {
+        threads.emplace_back([this] { run_pread(); });
+      }
+    }
+    else
+    {
+      threads.emplace_back([this] { run_io_uring(); });
+    }
+  }
+
+  ~Impl()
+  {
+    {
+      std::lock_guard lock{mutex};
+      stopping = true;
+    }
+    request_added.notify_all();
+    for (auto& t : threads)
+    {
+      t.join();
+    }
+  }
+
+  void read(const std::filesystem::path& path, std::function<void(Result)>&& on_read)
+  {
+    {
+      std::lock_guard lock{mutex};
+      requests.push_back(Request{path, std::move(on_read)});
+    }
+    request_added.notify_one();
+  }
+
+  /**
+   * @brief Takes the next request; if wait is true, blocks until one is available or the reader is stopping
+   */
+  std::optional<Request> pop_request(const bool wait)
+  {
+    std::unique_lock lock{mutex};
+    if (wait)
+    {
+      request_added.wait(lock, [this] { return stopping or !requests.empty(); });
+    }
+
+    if (requests.empty())
+    {
+      return std::nullopt;
+    }
+
+    auto request = std::move(requests.front());
+    requests.pop_front();
+    return request;
+  }
+
+  /**
+   * @brief Serves requests with blocking reads, one at a time
+   */
+  void run_pread()
+  {
+    while (auto request = pop_request(true))
+    {
+      auto fd_and_size = open_for_read(request->path);
+      if (!fd_and_size.has_value())
+      {
+        request->on_read(make_unexpected(fd_and_size.error()));
+        continue;
+      }
+
+      const auto [fd, size] = *fd_and_size;
+      auto storage = pool->acquire(size);
+      std::size_t offset = 0;
+      bool failed = false;
+      while (offset < size)
+      {
+        const ssize_t n = ::pread(fd, storage.bytes.get() + offset, size - offset, static_cast<off_t>(offset));
+        if (n > 0)
+        {
+          offset += static_cast<std::size_t>(n);
+        }
+        else if (n == 0)
+        {
+          break;
+        }
+        else if (errno != EINTR)
+        {
+          failed = true;
+          break;
+        }
+      }
+      ::close(fd);
+
+      if (failed)
+      {
+        pool->release(std::move(storage));
+        request->on_read(make_unexpected(FileReadError::kFailedToRead));
+      }
+      else
+      {
+        request->on_read(pool->make_buffer(std::move(storage), offset));
+      }
+    }
+  }
+
+  /**
+   * @brief Serves requests by keeping up to queue_depth reads in flight through io_uring
+   *
+   *        Each file is opened and stat-ed through the ring, at the same time, where the kernel supports it. Its
+   *        contents are read once both complete.
+   *
+   * @note newly requested reads are submitted as earlier reads complete, or immediately if none are in flight
+   */
+  void run_io_uring()
+  {
+    std::vector<Slot> slots(queue_depth);
+    std::vector<std::size_t> free_slots(queue_depth);
+    for (std::size_t i = 0; i < queue_depth; ++i)
+    {
+      free_slots[i] = queue_depth - i - 1;
+    }
+
+    const auto user_data = [](const std::size_t index, const RingOp op) {
+      return (static_cast<std::uint64_t>(index) << kRingOpBits) | op;
+    };
+
+    const auto submit = [&](Slot& slot, const std::size_t index) {
+      slot.iov.iov_base = slot.storage.bytes.get() + slot.offset;
+      slot.iov.iov_len = slot.size - slot.offset;
+      ring->prepare_read(slot.fd, &slot.iov, slot.offset, user_data(index, kRingRead));
+    };
+
+    const auto finish = [&](Slot& slot, const std::size_t index, const std::optional<FileReadError> error) {
+      if (slot.fd >= 0)
+      {
+        ::close(slot.fd);
+      }
+      if (error.has_value())
+      {
+        pool->release(std::move(slot.storage));
+        slot.request.on_read(make_unexpected(*error));
+      }
+      else
+      {
+        slot.request.on_read(pool->make_buffer(std::move(slot.storage), slot.offset));
+      }
+      slot = Slot{};
+      free_slots.push_back(index);
+    };
+
+    const auto start_read = [&](Slot& slot, const std::size_t index) {
+      slot.storage = pool->acquire(slot.size);
+      if (slot.size == 0)
+      {
+        finish(slot, index, std::nullopt);
+      }
+      else
+      {
+        submit(slot, index);
+      }
+    };
+
+    while (true)
+    {
+      // Start as many reads as there is room for, waiting for a request only if nothing is in flight
+      while (!free_slots.empty())
+      {
+        auto request = pop_request(free_slots.size() == queue_depth);
+        if (!request.has_value())
+        {
+          break;
+        }
+
+        const std::size_t index = free_slots.back();
+        free_slots.pop_back();
+
+        Slot& slot = slots[index];
+        slot.request = std::move(*request);
+        if (ring->supports_open_and_stat())
+        {
+          slot.pending_ops = 2;
+          ring->prepare_open(slot.request.path.c_str(), user_data(index, kRingOpen));
+          ring->prepare_stat(slot.request.path.c_str(), &slot.stx, user_data(index, kRingStat));
+        }
+        else if (auto fd_and_size = open_for_read(slot.request.path); fd_and_size.has_value())
+        {
+          std::tie(slot.fd, slot.size) = *fd_and_size;
+          start_read(slot, index);
+        }
+        else
+        {
+          finish(slot, index, fd_and_size.error());
+        }
+      }
+
+      if (free_slots.size() == queue_depth)
+      {
+        // Nothing in flight and no requests left, which only happens once stopping
+        std::lock_guard lock{mutex};
+        if (stopping and requests.empty())
+        {
+          return;
+        }
+        continue;
+      }
+
+      if (!ring->submit_and_wait())
+      {
+        // Ring is unusable; fail reads in flight and serve everything else with blocking reads
+        for (std::size_t i = 0; i < queue_depth; ++i)
+        {
+          if (slots[i].request.on_read != nullptr)
+          {
+            finish(slots[i], i, FileReadError::kFailedToRead);
+          }
+        }
+        run_pread();
+        return;
+      }
+
+      ring->reap([&](const std::uint64_t data, const int result) {
+        const std::size_t index = static_cast<std::size_t>(data >> kRingOpBits);
+        const auto op = static_cast<RingOp>(data & ((1UL << kRingOpBits) - 1));
+        Slot& slot = slots[index];
+        if (result == -EINTR or result == -EAGAIN)
+        {
+          if (op == kRingOpen)
+          {
+            ring->prepare_open(slot.request.path.c_str(), data);
+          }
+          else if (op == kRingStat)
+          {
+            ring->prepare_stat(slot.request.path.c_str(), &slot.stx, data);
+          }
+          else
+          {
+            submit(slot, index);
+          }
+          return;
+        }
+
+        if (op != kRingRead)
+        {
+          // Failing to open takes precedence, since a missing file fails both
+          if (op == kRingOpen and result < 0)
+          {
+            slot.error = FileReadError::kFailedToOpen;
+          }
+          else if (op == kRingOpen)
+          {
+            slot.fd = result;
+          }
+          else if (result < 0)
+          {
+            slot.error = slot.error.value_or(FileReadError::kFailedToRead);
+          }
+          else
+          {
+            slot.size = static_cast<std::size_t>(slot.stx.stx_size);
+          }
+
+          if (--slot.pending_ops > 0)
+          {
+            return;
+          }
+          else if (slot.error.has_value())
+          {
+            finish(slot, index, slot.error);
+          }
+          else
+          {
+            start_read(slot, index);
+          }
+        }
+        else if (result < 0)
+        {
+          finish(slot, index, FileReadError::kFailedToRead);
+        }
+        else if (result == 0)
+        {
+          // File was truncated while being read
+          finish(slot, index, std::nullopt);
+        }
+        else if (slot.offset += static_cast<std::size_t>(result); slot.offset < slot.size)
+        {
+          submit(slot, index);
+        }
+        else
+        {
+          finish(slot, index, std::nullopt);
+        }
+      });
+    }
+  }
+
+  /// Maximum number of reads in flight at once
+  std::size_t queue_depth;
+
+  /// Storage for file contents
+  std::shared_ptr<FileReadBufferPool> pool;
+
+  /// Ring through which reads are made; nullptr if reads are made with pread
+  std::unique_ptr<IoUring> ring;
+
+  /// Guards requests and stopping
+  std::mutex mutex;
+
+  /// Signaled when a request is added or the reader is stopping
+  std::condition_variable request_added;
+
+  /// Requests waiting to be served
+  std::deque<Request> requests;
+
+  /// Set when reader is destroyed
+  bool stopping = false;
+
+  /// Threads serving requests
+  std::vector<std::thread> threads;
+};
+
+FileReader::FileReader(const FileReaderOptions& options) : impl_{std::make_unique<Impl>(options)} {}
+
+FileReader::FileReader(FileReader&& other) = default;
+
+FileReader& FileReader::operator=(FileReader&& other) = default;
+
+FileReader::~FileReader() = default;
+
+std::future<FileReader::Result> FileReader::read(const std::filesystem::path& path)
+{
+  // Promise is shared so that the callback stays copyable
+  auto promise = std::make_shared<std::promise<Result>>();
+  auto future = promise->get_future();
+  impl_->read(path, [promise](Result result) { promise->set_value(std::move(result)); });
+  return future;
+}
+
+void FileReader::read(const std::filesystem::path& path, std::function<void(Result)> on_read)
+{
+  impl_->read(path, std::move(on_read));
+}
+
+bool FileReader::uses_io_uring() const { return impl_->ring != nullptr; }
+
+}  // namespace tyl::async
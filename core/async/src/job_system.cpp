@@ -0,0 +1,309 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file job_system.cpp
+ */
+
+// C++ Standard Library
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <optional>
+
+// Tyl
+#include <tyl/async/job_system.hpp>
+
+namespace tyl::async
+{
+
+/**
+ * @brief Queue of jobs, owned by one worker (or by threads outside the system), which other threads may steal from
+ */
+class JobQueue
+{
+public:
+  void push(Job&& job)
+  {
+    std::lock_guard lock{mutex_};
+    jobs_.push_back(std::move(job));
+  }
+
+  /**
+   * @brief Takes most recently pushed job; used by the owning worker
+   */
+  std::optional<Job> pop()
+  {
+    std::lock_guard lock{mutex_};
+    if (jobs_.empty())
+    {
+      return std::nullopt;
+    }
+    auto job = std::move(jobs_.back());
+    jobs_.pop_back();
+    return job;
+  }
+
+  /**
+   * @brief Takes least recently pushed job; used by all other threads
+   */
+  std::optional<Job> steal()
+  {
+    std::lock_guard lock{mutex_};
+    if (jobs_.empty())
+    {
+      return std::nullopt;
+    }
+    auto job = std::move(jobs_.front());
+    jobs_.pop_front();
+    return job;
+  }
+
+private:
+  /// Guards jobs_
+  std::mutex mutex_;
+  /// Queued jobs, oldest first
+  std::deque<Job> jobs_;
+};
+
+struct JobSystem::Impl
+{
+  /**
+   * @brief Identifies the job system and queue which belong to the current thread, if it is a worker
+   */
+  struct ThreadContext
+  {
+    /// Job system which owns the current thread
+    Impl* owner = nullptr;
+    /// Index of worker queue
+    std::size_t index = 0;
+  };
+
+  static thread_local ThreadContext this_thread_context;
+
+  explicit Impl(const std::size_t worker_count) : queues(worker_count)
+  {
+    workers.reserve(worker_count);
+    for (std::size_t i = 0; i < worker_count; ++i)
+    {
+      workers.emplace_back([this, i] { work(i); });
+    }
+  }
+
+  ~Impl()
+  {
+    // Run out whatever is left, so that no job is dropped, and wait out submits which may still be waking a worker for
+    // a job which has already been taken; only then is it safe to stop and destroy the workers
+    while (queued.load(std::memory_order_acquire) > 0 or submitting.load(std::memory_order_acquire) > 0)
+    {
+      if (!try_run_one())
+      {
+        std::this_thread::yield();
+      }
+    }
+    {
+      std::lock_guard lock{wake_mutex};
+      stopping = true;
+    }
+    wake_cv.notify_all();
+    for (auto& worker : workers)
+    {
+      worker.join();
+    }
+  }
+
+  void submit(Job&& job)
+  {
+    submitting.fetch_add(1, std::memory_order_acq_rel);
+
+    // Counted before the job is visible, so that the count never drops below zero when the job is taken right away
+    queued.fetch_add(1, std::memory_order_seq_cst);
+    if (this_thread_context.owner == this)
+    {
+      queues[this_thread_context.index].push(std::move(job));
+    }
+    else
+    {
+      shared_queue.push(std::move(job));
+    }
+
+    // Workers only sleep after counting themselves as sleeping and then finding nothing queued, so either a worker
+    // sees this job before sleeping, or this sees the sleeping worker and wakes it; taking the lock before notifying
+    // closes the gap between a worker checking for jobs and actually waiting
+    if (sleeping.load(std::memory_order_seq_cst) > 0)
+    {
+      {
+        std::lock_guard lock{wake_mutex};
+      }
+      wake_cv.notify_one();
+    }
+
+    submitting.fetch_sub(1, std::memory_order_acq_rel);
+  }
+
+  /**
+   * @brief Takes a job from the local queue, then the shared queue, then any other queue
+   */
+  std::optional<Job> take()
+  {
+    const bool is_worker = (this_thread_context.owner == this);
+    if (is_worker)
+    {
+      if (auto job = queues[this_thread_context.index].pop(); job)
+      {
+        return job;
+      }
+    }
+
+    // Threads which are not workers only take shared jobs while waiting on a group, so they take the newest, which
+    // are most likely to belong to that group; this keeps recursively split work depth-first
+    if (auto job = is_worker ? shared_queue.steal() : shared_queue.pop(); job)
+    {
+      return job;
+    }
+
+    // Start from a different queue on each thread, so that thieves spread out
+    const std::size_t offset = is_worker ? (this_thread_context.index + 1) : 0;
+    for (std::size_t i = 0; i < queues.size(); ++i)
+    {
+      if (auto job = queues[(offset + i) % queues.size()].steal(); job)
+      {
+        return job;
+      }
+    }
+    return std::nullopt;
+  }
+
+  bool try_run_one()
+  {
+    auto job = take();
+    if (!job)
+    {
+      return false;
+    }
+    queued.fetch_sub(1, std::memory_order_acq_rel);
+    (*job)();
+    return true;
+  }
+
+  void work(const std::size_t index)
+  {
+    this_thread_context = {this, index};
+    while (true)
+    {
+      if (try_run_one())
+      {
+        continue;
+      }
+
+      std::unique_lock lock{wake_mutex};
+      sleeping.fetch_add(1, std::memory_order_seq_cst);
+      wake_cv.wait(lock, [this] { return stopping or queued.load(std::memory_order_seq_cst) > 0; });
+      sleeping.fetch_sub(1, std::memory_order_relaxed);
+      if (stopping and queued.load(std::memory_order_acquire) == 0)
+      {
+        break;
+      }
+    }
+    this_thread_context = {};
+  }
+
+  /// Per-worker job queues
+  std::vector<JobQueue> queues;
+
+  /// Jobs submitted from threads which are not workers
+  JobQueue shared_queue;
+
+  /// Guards stopping; only locked by workers going to sleep, and by threads waking them
+  std::mutex wake_mutex;
+
+  /// Signaled when jobs are submitted while workers are asleep, or when workers should stop
+  std::condition_variable wake_cv;
+
+  /// Number of jobs submitted but not yet taken
+  std::atomic<std::size_t> queued = 0;
+
+  /// Number of workers asleep, or about to be, on wake_cv
+  std::atomic<std::size_t> sleeping = 0;
+
+  /// Number of calls to submit which have not yet returned
+  std::atomic<std::size_t> submitting = 0;
+
+  /// Set when workers should exit once all jobs are taken
+  bool stopping = false;
+
+  /// Worker threads
+  std::vector<std::thread> workers;
+};
+
+thread_local JobSystem::Impl::ThreadContext JobSystem::Impl::this_thread_context = {};
+
+JobSystem::JobSystem(const JobSystemOptions& options) : impl_{std::make_unique<Impl>(options.worker_count)} {}
+
+JobSystem::~JobSystem() = default;
+
+void JobSystem::submit(Job job) { impl_->submit(std::move(job)); }
+
+bool JobSystem::try_run_one() { return impl_->try_run_one(); }
+
+std::size_t JobSystem::worker_count() const { return impl_->workers.size(); }
+
+TaskGroup::TaskGroup(JobSystem& jobs) : jobs_{std::addressof(jobs)}, state_{std::make_shared<State>()}
+{
+  state_->jobs = jobs_;
+}
+
+TaskGroup::~TaskGroup() { wait(); }
+
+void TaskGroup::then(Job continuation)
+{
+  {
+    std::lock_guard lock{state_->continuations_mutex};
+    if (state_->pending.load(std::memory_order_acquire) != 0)
+    {
+      state_->continuations.push_back(std::move(continuation));
+      return;
+    }
+  }
+  continuation();
+}
+
+void TaskGroup::wait()
+{
+  while (!done())
+  {
+    // Help out rather than block while there is work queued, so that waiting from inside a job cannot starve workers
+    if (jobs_->try_run_one())
+    {
+      continue;
+    }
+
+    // Every job in the group is already running elsewhere; sleep until one of them finishes
+    if (const auto pending = state_->pending.load(std::memory_order_acquire); pending != 0)
+    {
+      state_->pending.wait(pending, std::memory_order_acquire);
+    }
+  }
+}
+
+void TaskGroup::finish(State& state)
+{
+  // Wakes waiting threads on every job, so that they may help with jobs that the finished one submitted
+  const bool last = (state.pending.fetch_sub(1, std::memory_order_acq_rel) == 1);
+  state.pending.notify_all();
+  if (!last)
+  {
+    return;
+  }
+
+  std::vector<Job> continuations;
+  {
+    std::lock_guard lock{state.continuations_mutex};
+    continuations.swap(state.continuations);
+  }
+  for (auto& continuation : continuations)
+  {
+    state.jobs->submit(std::move(continuation));
+  }
+}
+
+}  // namespace tyl::async
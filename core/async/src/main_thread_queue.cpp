@@ -0,0 +1,83 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file main_thread_queue.cpp
+ */
+
+// C++ Standard Library
+#include <utility>
+
+// Tyl
+#include <tyl/async/main_thread_queue.hpp>
+
+namespace tyl::async
+{
+
+// Nodes form a singly-linked list, oldest first. Posting threads swap themselves in as head_ and then link the
+// previous head to their node. tail_ always points to a spent node whose successor holds the oldest task. A node
+// which has been swapped in, but not yet linked, simply looks like the end of the queue until it is.
+
+MainThreadQueue::MainThreadQueue() : head_{new Node{}}, tail_{head_.load(std::memory_order_relaxed)} {}
+
+MainThreadQueue::~MainThreadQueue()
+{
+  // Posted work is often a suspended coroutine, whose frame is only freed once it runs to completion; dropping it
+  // would leak the frame, along with everything it holds (e.g. file contents)
+  drain();
+  delete tail_;
+}
+
+void MainThreadQueue::post(Task task)
+{
+  auto* const node = new Node{};
+  node->task = std::move(task);
+  Node* const prev = head_.exchange(node, std::memory_order_acq_rel);
+  prev->next.store(node, std::memory_order_release);
+}
+
+bool MainThreadQueue::pop(Task& task)
+{
+  Node* const next = tail_->next.load(std::memory_order_acquire);
+  if (next == nullptr)
+  {
+    return false;
+  }
+  task = std::move(next->task);
+  next->task = nullptr;
+  delete tail_;
+  tail_ = next;
+  return true;
+}
+
+std::size_t MainThreadQueue::drain()
+{
+  std::size_t count = 0;
+  Task task;
+  while (pop(task))
+  {
+    task();
+    ++count;
+  }
+  return count;
+}
+
+std::size_t MainThreadQueue::drain(const Duration budget)
+{
+  const auto deadline = std::chrono::steady_clock::now() + budget;
+  std::size_t count = 0;
+  Task task;
+  while (pop(task))
+  {
+    task();
+    ++count;
+    if (std::chrono::steady_clock::now() >= deadline)
+    {
+      break;
+    }
+  }
+  return count;
+}
+
+bool MainThreadQueue::empty() const { return tail_->next.load(std::memory_order_acquire) == nullptr; }
+
+}  // namespace tyl::async
@@ -0,0 +1,129 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ */
+
+// C++ Standard Library
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <future>
+#include <string>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Tyl
+#include <tyl/async/file_reader.hpp>
+
+using namespace tyl::async;
+
+namespace
+{
+
+std::vector<std::uint8_t> write_file(const std::string& filename, const std::size_t len)
+{
+  std::vector<std::uint8_t> bytes(len);
+  for (std::size_t i = 0; i < len; ++i)
+  {
+    bytes[i] = static_cast<std::uint8_t>((i * 31) ^ (i >> 8));
+  }
+  std::FILE* file = std::fopen(filename.c_str(), "wb");
+  if (!bytes.empty())
+  {
+    std::fwrite(bytes.data(), 1, bytes.size(), file);
+  }
+  std::fclose(file);
+  return bytes;
+}
+
+}  // namespace
+
+class FileReaderTest : public ::testing::TestWithParam<bool>
+{};
+
+TEST_P(FileReaderTest, FailedToOpen)
+{
+  FileReader reader{{.enable_io_uring = GetParam()}};
+
+  const auto result = reader.read("not-a-file.bin").get();
+  ASSERT_FALSE(result.has_value());
+  ASSERT_EQ(result.error(), FileReadError::kFailedToOpen);
+}
+
+TEST_P(FileReaderTest, ReadEmptyFile)
+{
+  write_file("file_reader_empty.bin", 0);
+  FileReader reader{{.enable_io_uring = GetParam()}};
+
+  const auto result = reader.read("file_reader_empty.bin").get();
+  ASSERT_TRUE(result.has_value());
+  ASSERT_TRUE(result->empty());
+}
+
+TEST_P(FileReaderTest, ReadManyFiles)
+{
+  static constexpr std::size_t kFileCount = 100;
+
+  std::vector<std::vector<std::uint8_t>> expected_contents;
+  for (std::size_t i = 0; i < kFileCount; ++i)
+  {
+    expected_contents.push_back(write_file("file_reader_" + std::to_string(i) + ".bin", 1000 * i + 1));
+  }
+
+  FileReader reader{{.queue_depth = 8, .pooled_buffer_count = 4, .enable_io_uring = GetParam()}};
+
+  std::vector<std::future<FileReader::Result>> reads;
+  for (std::size_t i = 0; i < kFileCount; ++i)
+  {
+    reads.push_back(reader.read("file_reader_" + std::to_string(i) + ".bin"));
+  }
+
+  for (std::size_t i = 0; i < kFileCount; ++i)
+  {
+    const auto result = reads[i].get();
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result->size(), expected_contents[i].size());
+    ASSERT_EQ(std::memcmp(result->data(), expected_contents[i].data(), result->size()), 0);
+  }
+}
+
+TEST_P(FileReaderTest, BufferOutlivesReader)
+{
+  const auto expected_contents = write_file("file_reader_outlives.bin", 4096);
+
+  FileReader::Result result;
+  {
+    FileReader reader{{.enable_io_uring = GetParam()}};
+    result = reader.read("file_reader_outlives.bin").get();
+  }
+  ASSERT_TRUE(result.has_value());
+  ASSERT_EQ(result->size(), expected_contents.size());
+  ASSERT_EQ(std::memcmp(result->data(), expected_contents.data(), result->size()), 0);
+}
+
+TEST_P(FileReaderTest, ReadWithCallback)
+{
+  const auto expected_contents = write_file("file_reader_callback.bin", 5000);
+
+  std::atomic<std::size_t> callback_count = 0;
+  {
+    FileReader reader{{.enable_io_uring = GetParam()}};
+    reader.read("file_reader_callback.bin", [&](FileReader::Result result) {
+      ASSERT_TRUE(result.has_value());
+      ASSERT_EQ(result->size(), expected_contents.size());
+      ASSERT_EQ(std::memcmp(result->data(), expected_contents.data(), result->size()), 0);
+      ++callback_count;
+    });
+    reader.read("not-a-file.bin", [&](FileReader::Result result) {
+      ASSERT_FALSE(result.has_value());
+      ASSERT_EQ(result.error(), FileReadError::kFailedToOpen);
+      ++callback_count;
+    });
+  }
+  ASSERT_EQ(callback_count, 2UL);
+}
+
+INSTANTIATE_TEST_SUITE_P(Backends, FileReaderTest, ::testing::Values(true, false));
@@ -0,0 +1,166 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ */
+
+// C++ Standard Library
+#include <atomic>
+#include <list>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Tyl
+#include <tyl/async/job_system.hpp>
+
+using namespace tyl::async;
+
+namespace
+{
+
+std::size_t fibonacci(JobSystem& jobs, const std::size_t n)
+{
+  if (n < 2)
+  {
+    return n;
+  }
+  std::size_t a = 0;
+  std::size_t b = 0;
+  TaskGroup group{jobs};
+  group.run([&jobs, &a, n] { a = fibonacci(jobs, n - 1); });
+  b = fibonacci(jobs, n - 2);
+  group.wait();
+  return a + b;
+}
+
+}  // namespace
+
+class JobSystemTest : public ::testing::TestWithParam<std::size_t>
+{};
+
+TEST_P(JobSystemTest, TaskGroupRunsAllJobs)
+{
+  JobSystem jobs{{.worker_count = GetParam()}};
+
+  std::atomic<std::size_t> count = 0;
+  {
+    TaskGroup group{jobs};
+    for (std::size_t i = 0; i < 1000; ++i)
+    {
+      group.run([&count] { ++count; });
+    }
+    group.wait();
+    ASSERT_TRUE(group.done());
+  }
+  ASSERT_EQ(count, 1000UL);
+}
+
+TEST_P(JobSystemTest, NestedForkJoin)
+{
+  JobSystem jobs{{.worker_count = GetParam()}};
+  ASSERT_EQ(fibonacci(jobs, 20), 6765UL);
+}
+
+TEST_P(JobSystemTest, ContinuationRunsAfterGroup)
+{
+  JobSystem jobs{{.worker_count = GetParam()}};
+
+  std::atomic<std::size_t> count = 0;
+  std::atomic<std::size_t> count_seen_by_continuation = 0;
+  std::atomic<bool> continued = false;
+  {
+    TaskGroup group{jobs};
+    for (std::size_t i = 0; i < 100; ++i)
+    {
+      group.run([&count] { ++count; });
+    }
+    group.then([&] {
+      count_seen_by_continuation = count.load();
+      continued = true;
+    });
+    group.wait();
+  }
+
+  while (!continued)
+  {
+    jobs.try_run_one();
+  }
+  ASSERT_EQ(count_seen_by_continuation, 100UL);
+}
+
+TEST_P(JobSystemTest, ContinuationOnIdleGroupRunsImmediately)
+{
+  JobSystem jobs{{.worker_count = GetParam()}};
+
+  bool continued = false;
+  TaskGroup group{jobs};
+  group.then([&continued] { continued = true; });
+  ASSERT_TRUE(continued);
+}
+
+TEST_P(JobSystemTest, ParallelForEachRandomAccess)
+{
+  JobSystem jobs{{.worker_count = GetParam()}};
+
+  std::vector<std::size_t> values(10000);
+  std::iota(values.begin(), values.end(), 0);
+  parallel_for_each(jobs, values, [](std::size_t& v) { v *= 2; }, 100);
+
+  for (std::size_t i = 0; i < values.size(); ++i)
+  {
+    ASSERT_EQ(values[i], 2 * i);
+  }
+}
+
+TEST_P(JobSystemTest, ParallelForEachForward)
+{
+  JobSystem jobs{{.worker_count = GetParam()}};
+
+  std::list<std::size_t> values(1001, 1);
+  std::atomic<std::size_t> sum = 0;
+  parallel_for_each(jobs, values, [&sum](const std::size_t v) { sum += v; }, 64);
+  ASSERT_EQ(sum, 1001UL);
+}
+
+TEST_P(JobSystemTest, DestructorFinishesSubmittedJobs)
+{
+  std::atomic<std::size_t> count = 0;
+  {
+    JobSystem jobs{{.worker_count = GetParam()}};
+    for (std::size_t i = 0; i < 100; ++i)
+    {
+      jobs.submit([&count] { ++count; });
+    }
+  }
+  ASSERT_EQ(count, 100UL);
+}
+
+TEST_P(JobSystemTest, ManyThreadsWaitOnGroups)
+{
+  JobSystem jobs{{.worker_count = GetParam()}};
+
+  // Small groups, waited on one at a time, so that workers keep going to sleep and being woken back up
+  std::atomic<std::size_t> count = 0;
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < 4; ++t)
+  {
+    threads.emplace_back([&jobs, &count] {
+      for (std::size_t i = 0; i < 250; ++i)
+      {
+        TaskGroup group{jobs};
+        group.run([&count] { ++count; });
+        group.run([&count] { ++count; });
+        group.wait();
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  ASSERT_EQ(count, 2000UL);
+}
+
+INSTANTIATE_TEST_SUITE_P(WorkerCounts, JobSystemTest, ::testing::Values(0, 1, 4));
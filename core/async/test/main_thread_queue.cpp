@@ -0,0 +1,112 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ */
+
+// C++ Standard Library
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Tyl
+#include <tyl/async/main_thread_queue.hpp>
+
+using namespace tyl::async;
+
+TEST(MainThreadQueue, DrainEmpty)
+{
+  MainThreadQueue queue;
+  ASSERT_TRUE(queue.empty());
+  ASSERT_EQ(queue.drain(), 0UL);
+}
+
+TEST(MainThreadQueue, DrainRunsTasksInOrder)
+{
+  MainThreadQueue queue;
+
+  std::vector<int> order;
+  for (int i = 0; i < 10; ++i)
+  {
+    queue.post([&order, i] { order.push_back(i); });
+  }
+  ASSERT_FALSE(queue.empty());
+  ASSERT_EQ(queue.drain(), 10UL);
+  ASSERT_TRUE(queue.empty());
+
+  for (int i = 0; i < 10; ++i)
+  {
+    ASSERT_EQ(order[i], i);
+  }
+}
+
+TEST(MainThreadQueue, DrainWithinBudget)
+{
+  MainThreadQueue queue;
+
+  for (int i = 0; i < 10; ++i)
+  {
+    queue.post([] { std::this_thread::sleep_for(std::chrono::milliseconds{5}); });
+  }
+
+  // At least one task always runs, even with no budget
+  ASSERT_EQ(queue.drain(std::chrono::milliseconds{0}), 1UL);
+
+  const std::size_t count = queue.drain(std::chrono::milliseconds{12});
+  ASSERT_GE(count, 1UL);
+  ASSERT_LT(count, 9UL);
+  ASSERT_EQ(queue.drain(), 9UL - count);
+}
+
+TEST(MainThreadQueue, PostFromManyThreads)
+{
+  MainThreadQueue queue;
+
+  static constexpr std::size_t kThreadCount = 8;
+  static constexpr std::size_t kPostsPerThread = 1000;
+
+  std::vector<std::size_t> last_seen(kThreadCount, 0);
+  std::size_t run_count = 0;
+
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < kThreadCount; ++t)
+  {
+    threads.emplace_back([&queue, &last_seen, &run_count, t] {
+      for (std::size_t i = 1; i <= kPostsPerThread; ++i)
+      {
+        queue.post([&last_seen, &run_count, t, i] {
+          // Tasks from any one thread run in the order that thread posted them
+          ASSERT_EQ(last_seen[t] + 1, i);
+          last_seen[t] = i;
+          ++run_count;
+        });
+      }
+    });
+  }
+
+  while (run_count < kThreadCount * kPostsPerThread)
+  {
+    queue.drain();
+  }
+
+  for (auto& t : threads)
+  {
+    t.join();
+  }
+  ASSERT_EQ(run_count, kThreadCount * kPostsPerThread);
+}
+
+TEST(MainThreadQueue, DestructorRunsQueuedTasks)
+{
+  auto resource = std::make_shared<int>(0);
+  {
+    MainThreadQueue queue;
+    queue.post([resource] { ++(*resource); });
+    queue.post([&queue, resource] { queue.post([resource] { ++(*resource); }); });
+    ASSERT_EQ(resource.use_count(), 3);
+  }
+  ASSERT_EQ(*resource, 2);
+  ASSERT_EQ(resource.use_count(), 1);
+}
@@ -0,0 +1,116 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ */
+
+// C++ Standard Library
+#include <atomic>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Tyl
+#include <tyl/async/task.hpp>
+
+using namespace tyl::async;
+
+namespace
+{
+
+Task<int> make_value(const int value) { co_return value; }
+
+Task<int> add_values(const int lhs, const int rhs) { co_return (co_await make_value(lhs)) + (co_await make_value(rhs)); }
+
+Task<std::thread::id> thread_of_job(JobSystem& jobs)
+{
+  co_await schedule_on(jobs);
+  co_return std::this_thread::get_id();
+}
+
+Task<int> throws_error()
+{
+  throw std::runtime_error{"error"};
+  co_return 0;
+}
+
+Task<std::size_t> file_size_on_main_thread(
+  FileReader& reader,
+  JobSystem& jobs,
+  MainThreadQueue& queue,
+  std::filesystem::path path,
+  std::thread::id& resumed_on)
+{
+  auto contents = co_await read_file(reader, std::move(path), jobs);
+  co_await schedule_on(queue);
+  resumed_on = std::this_thread::get_id();
+  co_return contents.has_value() ? contents->size() : 0UL;
+}
+
+Task<void> hold_until_main_thread(MainThreadQueue& queue, std::shared_ptr<int> resource)
+{
+  co_await schedule_on(queue);
+  ++(*resource);
+}
+
+}  // namespace
+
+TEST(Task, NestedAwait) { ASSERT_EQ(sync_wait(add_values(1, 2)), 3); }
+
+TEST(Task, ScheduleOnJobSystem)
+{
+  JobSystem jobs{{.worker_count = 1}};
+  ASSERT_NE(sync_wait(thread_of_job(jobs)), std::this_thread::get_id());
+}
+
+TEST(Task, ExceptionPropagatesToAwaiter) { ASSERT_THROW(sync_wait(throws_error()), std::runtime_error); }
+
+TEST(Task, ReadFileThenResumeOnMainThread)
+{
+  {
+    std::FILE* file = std::fopen("task_read_file.bin", "wb");
+    const std::string contents(1234, 'x');
+    std::fwrite(contents.data(), 1, contents.size(), file);
+    std::fclose(file);
+  }
+
+  MainThreadQueue queue;
+  JobSystem jobs{{.worker_count = 1}};
+  FileReader reader;
+
+  std::atomic<std::size_t> size = 0;
+  std::thread::id resumed_on;
+  spawn([](
+          FileReader& reader,
+          JobSystem& jobs,
+          MainThreadQueue& queue,
+          std::atomic<std::size_t>& size,
+          std::thread::id& resumed_on) -> Task<void> {
+    size = co_await file_size_on_main_thread(reader, jobs, queue, "task_read_file.bin", resumed_on);
+  }(reader, jobs, queue, size, resumed_on));
+
+  while (size == 0)
+  {
+    queue.drain();
+  }
+  ASSERT_EQ(size, 1234UL);
+  ASSERT_EQ(resumed_on, std::this_thread::get_id());
+}
+
+TEST(Task, QueueDestructorFinishesSuspendedTasks)
+{
+  auto resource = std::make_shared<int>(0);
+  {
+    MainThreadQueue queue;
+    spawn(hold_until_main_thread(queue, resource));
+    ASSERT_EQ(resource.use_count(), 2);
+  }
+
+  // Coroutine frame, and everything it held, is gone once the queue is
+  ASSERT_EQ(*resource, 1);
+  ASSERT_EQ(resource.use_count(), 1);
+}
@@ -39,7 +39,8 @@ public:
   Sound(const Sound&) = delete;
   Sound(Sound&& other);
 
-  Sound& operator==(const Sound& other) = delete;
+  Sound& operator=(const Sound& other) = delete;
+  Sound& operator=(Sound&& other);
 
   /**
    * @brief Instances sound from sound data
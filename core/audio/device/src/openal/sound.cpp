@@ -7,6 +7,7 @@
 // C++ Standard Library
 #include <cstdio>
 #include <cstdlib>
+#include <memory>
 #include <new>
 
 // Tyl
@@ -40,6 +41,16 @@ Sound::Sound(Sound&& other) : buffer_{other.buffer_}, buffer_length_{other.buffe
   other.buffer_length_ = 0;
 }
 
+Sound& Sound::operator=(Sound&& other)
+{
+  if (this != std::addressof(other))
+  {
+    this->~Sound();
+    new (this) Sound{std::move(other)};
+  }
+  return *this;
+}
+
 Sound::Sound() { TYL_AL_TEST_ERROR(alGenBuffers(1, &buffer_)); }
 
 Sound::Sound(
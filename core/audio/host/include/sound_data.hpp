@@ -59,6 +59,11 @@ public:
    */
   static expected<SoundData, Error> load(const std::filesystem::path& path);
 
+  /**
+   * @brief Loads a sound from WAV file contents in memory
+   */
+  static expected<SoundData, Error> load(const void* data, const std::size_t len);
+
   /**
    * @brief Number of bytes used to store sound data
    */
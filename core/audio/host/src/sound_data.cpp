@@ -5,8 +5,10 @@
  */
 
 // C++ Standard Library
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
 
 // LibAudio
@@ -26,6 +28,17 @@ template <typename T, typename D> std::unique_ptr<T, D> make_wave_uptr(T* p, D d
   return {p, std::move(deleter)};
 }
 
+/// Reads a little-endian unsigned integer from a byte buffer
+template <typename UIntT> UIntT read_le(const std::uint8_t* const bytes)
+{
+  UIntT value = 0;
+  for (std::size_t i = 0; i < sizeof(UIntT); ++i)
+  {
+    value |= static_cast<UIntT>(bytes[i]) << (8 * i);
+  }
+  return value;
+}
+
 }  // namespace
 
 expected<SoundData, SoundData::Error> SoundData::create(
@@ -108,4 +121,74 @@ expected<SoundData, SoundData::Error> SoundData::load(const std::filesystem::pat
       .bit_depth = static_cast<std::uint32_t>(wave->bitsPerSample)});
 }
 
+expected<SoundData, SoundData::Error> SoundData::load(const void* data, const std::size_t len)
+{
+  static constexpr std::size_t kRIFFHeaderSize = 12;
+  static constexpr std::size_t kChunkHeaderSize = 8;
+  static constexpr std::size_t kFormatChunkMinSize = 16;
+  static constexpr std::uint16_t kFormatPCM = 1;
+
+  const auto* const bytes = static_cast<const std::uint8_t*>(data);
+
+  // Check RIFF/WAVE header
+  if (
+    (bytes == nullptr) or (len < kRIFFHeaderSize) or (std::memcmp(bytes, "RIFF", 4) != 0) or
+    (std::memcmp(bytes + 8, "WAVE", 4) != 0))
+  {
+    return make_unexpected(Error::kInvalidSoundFile);
+  }
+
+  ChannelFormat channel_format;
+  std::size_t sample_rate = 0;
+  const std::uint8_t* wave_samples = nullptr;
+  std::size_t wave_samples_size = 0;
+
+  // Walk chunks until both format and sample data have been found
+  for (std::size_t offset = kRIFFHeaderSize; offset + kChunkHeaderSize <= len;)
+  {
+    const auto* const chunk = bytes + offset;
+    const std::size_t chunk_size = read_le<std::uint32_t>(chunk + 4);
+    const std::size_t chunk_data_offset = offset + kChunkHeaderSize;
+    if (chunk_size > (len - chunk_data_offset))
+    {
+      return make_unexpected(Error::kInvalidReadSize);
+    }
+
+    if (std::memcmp(chunk, "fmt ", 4) == 0)
+    {
+      if ((chunk_size < kFormatChunkMinSize) or (read_le<std::uint16_t>(bytes + chunk_data_offset) != kFormatPCM))
+      {
+        return make_unexpected(Error::kInvalidSoundFile);
+      }
+      channel_format.count = read_le<std::uint16_t>(bytes + chunk_data_offset + 2);
+      sample_rate = read_le<std::uint32_t>(bytes + chunk_data_offset + 4);
+      channel_format.bit_depth = read_le<std::uint16_t>(bytes + chunk_data_offset + 14);
+    }
+    else if (std::memcmp(chunk, "data", 4) == 0)
+    {
+      wave_samples = bytes + chunk_data_offset;
+      wave_samples_size = chunk_size;
+    }
+
+    // Chunks are padded to an even number of bytes
+    offset = chunk_data_offset + chunk_size + (chunk_size & 1);
+  }
+
+  if ((wave_samples == nullptr) or (wave_samples_size == 0) or (sample_rate == 0))
+  {
+    return make_unexpected(Error::kInvalidSoundFile);
+  }
+
+  // Copy WAV data; SoundData owns its buffer
+  auto* wave_data = std::malloc(wave_samples_size);
+  std::memcpy(wave_data, wave_samples, wave_samples_size);
+
+  auto sound_or_error = SoundData::create(wave_data, wave_samples_size, sample_rate, channel_format);
+  if (!sound_or_error.has_value())
+  {
+    std::free(wave_data);
+  }
+  return sound_or_error;
+}
+
 }  // namespace tyl::audio::host
@@ -0,0 +1,216 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ */
+
+// C++ Standard Library
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Tyl
+#include <tyl/audio/host/sound_data.hpp>
+
+using namespace tyl::audio::host;
+
+namespace
+{
+
+/**
+ * @brief Builds WAV file contents in memory
+ */
+class WaveBuilder
+{
+public:
+  WaveBuilder& chunk(std::string_view id, const std::vector<std::uint8_t>& data)
+  {
+    return chunk(id, data, data.size());
+  }
+
+  WaveBuilder& chunk(std::string_view id, const std::vector<std::uint8_t>& data, const std::uint32_t declared_size)
+  {
+    chunks_.insert(chunks_.end(), id.begin(), id.end());
+    append_le(chunks_, declared_size);
+    chunks_.insert(chunks_.end(), data.begin(), data.end());
+    if (data.size() & 1)
+    {
+      chunks_.push_back(0);
+    }
+    return *this;
+  }
+
+  WaveBuilder& format(
+    const std::uint16_t channels,
+    const std::uint32_t sample_rate,
+    const std::uint16_t bits_per_sample,
+    const std::uint16_t format_tag = 1)
+  {
+    std::vector<std::uint8_t> data;
+    append_le(data, format_tag);
+    append_le(data, channels);
+    append_le(data, sample_rate);
+    append_le(data, static_cast<std::uint32_t>(sample_rate * channels * bits_per_sample / 8));
+    append_le(data, static_cast<std::uint16_t>(channels * bits_per_sample / 8));
+    append_le(data, bits_per_sample);
+    return chunk("fmt ", data);
+  }
+
+  std::vector<std::uint8_t> build(std::string_view riff = "RIFF", std::string_view wave = "WAVE") const
+  {
+    std::vector<std::uint8_t> bytes{riff.begin(), riff.end()};
+    append_le(bytes, static_cast<std::uint32_t>(4 + chunks_.size()));
+    bytes.insert(bytes.end(), wave.begin(), wave.end());
+    bytes.insert(bytes.end(), chunks_.begin(), chunks_.end());
+    return bytes;
+  }
+
+private:
+  template <typename UIntT> static void append_le(std::vector<std::uint8_t>& bytes, const UIntT value)
+  {
+    for (std::size_t i = 0; i < sizeof(UIntT); ++i)
+    {
+      bytes.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+    }
+  }
+
+  std::vector<std::uint8_t> chunks_;
+};
+
+const std::vector<std::uint8_t> kSamples = {1, 2, 3, 4, 5, 6, 7, 8};
+
+}  // namespace
+
+TEST(SoundDataLoadFromMemory, PCM)
+{
+  const auto bytes = WaveBuilder{}.format(2, 44100, 16).chunk("data", kSamples).build();
+
+  auto sound_data_or_error = SoundData::load(bytes.data(), bytes.size());
+  ASSERT_TRUE(sound_data_or_error.has_value());
+  ASSERT_EQ(sound_data_or_error->get_buffer_length(), kSamples.size());
+  ASSERT_EQ(sound_data_or_error->bit_rate(), 44100UL);
+  ASSERT_EQ(sound_data_or_error->channel_format().count, 2U);
+  ASSERT_EQ(sound_data_or_error->channel_format().bit_depth, 16U);
+}
+
+TEST(SoundDataLoadFromMemory, SkipsOtherChunksWithPadding)
+{
+  const auto bytes = WaveBuilder{}
+                       .chunk("LIST", {'o', 'd', 'd'})
+                       .chunk("data", kSamples)
+                       .format(1, 22050, 8)
+                       .build();
+
+  auto sound_data_or_error = SoundData::load(bytes.data(), bytes.size());
+  ASSERT_TRUE(sound_data_or_error.has_value());
+  ASSERT_EQ(sound_data_or_error->get_buffer_length(), kSamples.size());
+  ASSERT_EQ(sound_data_or_error->bit_rate(), 22050UL);
+  ASSERT_EQ(sound_data_or_error->channel_format().count, 1U);
+}
+
+TEST(SoundDataLoadFromMemory, Null)
+{
+  const auto sound_data_or_error = SoundData::load(nullptr, 0);
+  ASSERT_FALSE(sound_data_or_error.has_value());
+  ASSERT_EQ(sound_data_or_error.error(), SoundData::Error::kInvalidSoundFile);
+}
+
+TEST(SoundDataLoadFromMemory, TruncatedHeader)
+{
+  const auto bytes = WaveBuilder{}.build();
+
+  const auto sound_data_or_error = SoundData::load(bytes.data(), 10);
+  ASSERT_FALSE(sound_data_or_error.has_value());
+  ASSERT_EQ(sound_data_or_error.error(), SoundData::Error::kInvalidSoundFile);
+}
+
+TEST(SoundDataLoadFromMemory, NotRIFF)
+{
+  const auto bytes = WaveBuilder{}.format(1, 44100, 16).chunk("data", kSamples).build("RIFX");
+
+  const auto sound_data_or_error = SoundData::load(bytes.data(), bytes.size());
+  ASSERT_FALSE(sound_data_or_error.has_value());
+  ASSERT_EQ(sound_data_or_error.error(), SoundData::Error::kInvalidSoundFile);
+}
+
+TEST(SoundDataLoadFromMemory, NotWAVE)
+{
+  const auto bytes = WaveBuilder{}.format(1, 44100, 16).chunk("data", kSamples).build("RIFF", "AVI ");
+
+  const auto sound_data_or_error = SoundData::load(bytes.data(), bytes.size());
+  ASSERT_FALSE(sound_data_or_error.has_value());
+  ASSERT_EQ(sound_data_or_error.error(), SoundData::Error::kInvalidSoundFile);
+}
+
+TEST(SoundDataLoadFromMemory, ChunkPastEnd)
+{
+  const auto bytes = WaveBuilder{}.format(1, 44100, 16).chunk("data", kSamples, 1000).build();
+
+  const auto sound_data_or_error = SoundData::load(bytes.data(), bytes.size());
+  ASSERT_FALSE(sound_data_or_error.has_value());
+  ASSERT_EQ(sound_data_or_error.error(), SoundData::Error::kInvalidReadSize);
+}
+
+TEST(SoundDataLoadFromMemory, ChunkSizeOverflow)
+{
+  const auto bytes = WaveBuilder{}.format(1, 44100, 16).chunk("data", kSamples, 0xFFFFFFFF).build();
+
+  const auto sound_data_or_error = SoundData::load(bytes.data(), bytes.size());
+  ASSERT_FALSE(sound_data_or_error.has_value());
+  ASSERT_EQ(sound_data_or_error.error(), SoundData::Error::kInvalidReadSize);
+}
+
+TEST(SoundDataLoadFromMemory, NotPCM)
+{
+  const auto bytes = WaveBuilder{}.format(1, 44100, 16, 3).chunk("data", kSamples).build();
+
+  const auto sound_data_or_error = SoundData::load(bytes.data(), bytes.size());
+  ASSERT_FALSE(sound_data_or_error.has_value());
+  ASSERT_EQ(sound_data_or_error.error(), SoundData::Error::kInvalidSoundFile);
+}
+
+TEST(SoundDataLoadFromMemory, FormatTooSmall)
+{
+  const auto bytes = WaveBuilder{}.chunk("fmt ", {1, 0, 1, 0}).chunk("data", kSamples).build();
+
+  const auto sound_data_or_error = SoundData::load(bytes.data(), bytes.size());
+  ASSERT_FALSE(sound_data_or_error.has_value());
+  ASSERT_EQ(sound_data_or_error.error(), SoundData::Error::kInvalidSoundFile);
+}
+
+TEST(SoundDataLoadFromMemory, MissingFormat)
+{
+  const auto bytes = WaveBuilder{}.chunk("data", kSamples).build();
+
+  const auto sound_data_or_error = SoundData::load(bytes.data(), bytes.size());
+  ASSERT_FALSE(sound_data_or_error.has_value());
+  ASSERT_EQ(sound_data_or_error.error(), SoundData::Error::kInvalidSoundFile);
+}
+
+TEST(SoundDataLoadFromMemory, MissingData)
+{
+  const auto bytes = WaveBuilder{}.format(1, 44100, 16).build();
+
+  const auto sound_data_or_error = SoundData::load(bytes.data(), bytes.size());
+  ASSERT_FALSE(sound_data_or_error.has_value());
+  ASSERT_EQ(sound_data_or_error.error(), SoundData::Error::kInvalidSoundFile);
+}
+
+TEST(SoundDataLoadFromMemory, InvalidChannelCount)
+{
+  const auto bytes = WaveBuilder{}.format(3, 44100, 16).chunk("data", kSamples).build();
+
+  const auto sound_data_or_error = SoundData::load(bytes.data(), bytes.size());
+  ASSERT_FALSE(sound_data_or_error.has_value());
+  ASSERT_EQ(sound_data_or_error.error(), SoundData::Error::kInvalidChannelCount);
+}
+
+TEST(SoundDataLoadFromMemory, InvalidBitDepth)
+{
+  const auto bytes = WaveBuilder{}.format(1, 44100, 0).chunk("data", kSamples).build();
+
+  const auto sound_data_or_error = SoundData::load(bytes.data(), bytes.size());
+  ASSERT_FALSE(sound_data_or_error.has_value());
+  ASSERT_EQ(sound_data_or_error.error(), SoundData::Error::kInvalidChannelBitDepth);
+}
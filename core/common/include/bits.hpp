@@ -1,11 +1,13 @@
 /**
  * @copyright 2021-present Brian Cairl
  *
- * @file bitops.hpp
+ * @file bits.hpp
  */
 #pragma once
 
 // C++ Standard Library
+#include <bit>
+#include <cstddef>
 #include <limits>
 #include <type_traits>
 #include <utility>
@@ -104,6 +106,14 @@ template <typename BlockT> constexpr BlockT make_mask(const std::size_t offset)
  */
 template <typename BlockT, std::size_t Offset> constexpr BlockT make_mask() { return (one<BlockT>() << Offset); }
 
+/**
+ * @brief Returns a default \c BlockT where the bits at and above \c offset are set high, and all others set to low
+ */
+template <typename BlockT> constexpr BlockT make_mask_from(const std::size_t offset)
+{
+  return static_cast<BlockT>(all<BlockT>() << offset);
+}
+
 /**
  * @brief Returns a default \c BlockT where the first-N bits are set high, and all others set to low
  */
@@ -127,8 +137,28 @@ template <typename BlockT> constexpr bool is_one_hot(BlockT m) { return m and !(
 
 /**
  * @brief Returns the number of bits set in a block
+ *
+ * @note compiles to a single population count instruction where the target supports one
+ */
+template <typename BlockT> constexpr std::size_t count(const BlockT n)
+{
+  return static_cast<std::size_t>(std::popcount(static_cast<std::make_unsigned_t<BlockT>>(n)));
+}
+
+/**
+ * @brief Returns the offset of the lowest bit set in a block
+ *
+ * @note returns size<BlockT>() if no bits are set
+ */
+template <typename BlockT> constexpr std::size_t first(const BlockT n)
+{
+  return static_cast<std::size_t>(std::countr_zero(static_cast<std::make_unsigned_t<BlockT>>(n)));
+}
+
+/**
+ * @brief Returns a copy of a block with its lowest set bit cleared
  */
-template <typename BlockT> constexpr BlockT count(const BlockT n) { return (n == 0) ? 0 : ((n & 1) + count(n >> 1)); }
+template <typename BlockT> constexpr BlockT clear_first(const BlockT n) { return n & (n - 1); }
 
 /**
  * @brief Returns \c true if any bit is set
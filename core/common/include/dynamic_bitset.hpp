@@ -6,8 +6,14 @@
 #pragma once
 
 // C++ Standard Library
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstring>
+#include <iterator>
+#include <limits>
 #include <memory>
+#include <memory_resource>
 #include <numeric>
 #include <type_traits>
 
@@ -17,13 +23,33 @@
 namespace tyl
 {
 
-template <typename BlockT, typename Alloc = std::allocator<BlockT>> class dynamic_bitset
+/**
+ * @brief Resizable set of bits, stored in contiguous blocks
+ *
+ *        Up to \c InlineBlockCount blocks are stored within the bitset itself, so that small bitsets never allocate.
+ *        Larger bitsets are stored in memory provided by \c Alloc, which may be a polymorphic allocator (see
+ *        tyl::pmr::dynamic_bitset) to draw from an arena.
+ *
+ * @note bits in storage beyond size() are unspecified; all read operations ignore them
+ */
+template <typename BlockT, typename Alloc = std::allocator<BlockT>, std::size_t InlineBlockCount = 2>
+class dynamic_bitset
 {
   static_assert(std::is_integral<BlockT>(), "Block type must be integral type");
 
+  using allocator_traits = std::allocator_traits<Alloc>;
+
 public:
+  using allocator_type = Alloc;
+
   static constexpr std::size_t bits_per_block = bits::size<BlockT>();
 
+  /// Number of blocks stored without allocation
+  static constexpr std::size_t inline_block_count = InlineBlockCount;
+
+  /// Value returned by find operations when no set bit is found
+  static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
   // clang-format off
   using const_block_return_t = std::conditional_t<
     (sizeof(BlockT) < sizeof(BlockT&)),
@@ -32,118 +58,505 @@ public:
   >;
   // clang-format on
 
-  dynamic_bitset() = default;
+  dynamic_bitset() : dynamic_bitset{Alloc{}} {}
+
+  explicit dynamic_bitset(const Alloc& allocator) :
+      inline_blocks_{}, block_data_{inline_blocks_.data()}, capacity_{InlineBlockCount}, bit_count_{0}, allocator_{allocator}
+  {}
 
-  explicit dynamic_bitset(const std::size_t bit_count)
+  explicit dynamic_bitset(const std::size_t bit_count, const Alloc& allocator = Alloc{}) :
+      dynamic_bitset{bit_count, false, allocator}
+  {}
+
+  dynamic_bitset(const std::size_t bit_count, const bool initial_state, const Alloc& allocator = Alloc{}) :
+      dynamic_bitset{allocator}
   {
-    dynamic_bitset::allocate(bits::min_blocks<BlockT>(bit_count));
+    dynamic_bitset::reserve(bit_count);
     bit_count_ = bit_count;
+    dynamic_bitset::fill(initial_state);
   }
 
-  dynamic_bitset(const std::size_t bit_count, const bool initial_state) :
-      block_data_{nullptr}, block_count_{bits::min_blocks<BlockT>(bit_count)}, bit_count_{bit_count}, allocator_{}
+  dynamic_bitset(const dynamic_bitset& other) :
+      dynamic_bitset{other, allocator_traits::select_on_container_copy_construction(other.allocator_)}
+  {}
+
+  dynamic_bitset(const dynamic_bitset& other, const Alloc& allocator) : dynamic_bitset{allocator}
   {
-    dynamic_bitset::allocate(block_count_);
+    dynamic_bitset::assign(other);
   }
 
-  dynamic_bitset(const dynamic_bitset& other) :
-      block_data_{other.block_data_},
-      block_count_{other.block_count_},
-      bit_count_{other.bit_count_},
-      allocator_{other.allocator_}
+  dynamic_bitset(dynamic_bitset&& other) noexcept : dynamic_bitset{std::move(other.allocator_)}
   {
-    dynamic_bitset::allocate(block_count_);
-    std::memcpy(block_data_, other.block_data_, sizeof(BlockT) * block_count_);
+    dynamic_bitset::take(other);
   }
 
-  dynamic_bitset(dynamic_bitset&& other) :
-      block_data_{other.block_data_},
-      block_count_{other.block_count_},
-      bit_count_{other.bit_count_},
-      allocator_{other.allocator_}
+  dynamic_bitset& operator=(const dynamic_bitset& other)
   {
-    other.block_data_ = nullptr;
+    if (this == &other)
+    {
+      return *this;
+    }
+
+    if constexpr (allocator_traits::propagate_on_container_copy_assignment::value)
+    {
+      if (allocator_ != other.allocator_)
+      {
+        dynamic_bitset::release();
+      }
+      allocator_ = other.allocator_;
+    }
+
+    dynamic_bitset::assign(other);
+    return *this;
+  }
+
+  dynamic_bitset& operator=(dynamic_bitset&& other) noexcept(
+    allocator_traits::propagate_on_container_move_assignment::value or allocator_traits::is_always_equal::value)
+  {
+    if (this == &other)
+    {
+      return *this;
+    }
+
+    if constexpr (allocator_traits::propagate_on_container_move_assignment::value)
+    {
+      dynamic_bitset::release();
+      allocator_ = std::move(other.allocator_);
+      dynamic_bitset::take(other);
+    }
+    else if (allocator_ == other.allocator_)
+    {
+      dynamic_bitset::release();
+      dynamic_bitset::take(other);
+    }
+    else
+    {
+      // Storage from another allocator cannot be adopted; copy blocks instead
+      dynamic_bitset::assign(other);
+    }
+    return *this;
   }
 
   ~dynamic_bitset() { dynamic_bitset::deallocate(); }
 
+  /**
+   * @brief Resizes bitset; bits added beyond the previous size are set to \c state
+   */
   void resize(const std::size_t bit_count, const bool state = false)
   {
-    if (const std::size_t new_block_count = bits::min_blocks<BlockT>(bit_count); new_block_count > block_count_)
+    dynamic_bitset::reserve(bit_count);
+    const std::size_t prev_bit_count = bit_count_;
+    bit_count_ = bit_count;
+    if (state)
     {
-      const std::size_t prev_block_count = block_count_;
-      dynamic_bitset::reallocate(new_block_count);
-      dynamic_bitset::fill(prev_block_count, block_count_, bits::default_block<BlockT>(state));
+      dynamic_bitset::set(prev_bit_count, bit_count);
+    }
+    else
+    {
+      dynamic_bitset::clear(prev_bit_count, bit_count);
     }
-    bit_count_ = bit_count;
   }
 
-  void shrink_to_fit() { dynamic_bitset::reallocate(dynamic_bitset::min_block_count()); }
+  /**
+   * @brief Ensures that storage for at least \c bit_count bits is available without further allocation
+   *
+   * @note storage grows geometrically, so repeated resizes allocate a logarithmic number of times
+   */
+  void reserve(const std::size_t bit_count)
+  {
+    if (const std::size_t required_block_count = bits::min_blocks<BlockT>(bit_count); required_block_count > capacity_)
+    {
+      dynamic_bitset::reallocate(std::max(required_block_count, 2 * capacity_));
+    }
+  }
 
-  void clear()
+  /**
+   * @brief Releases unused storage, moving back to inline storage if possible
+   */
+  void shrink_to_fit()
   {
-    block_count_ = 0;
-    bit_count_ = 0;
+    if (dynamic_bitset::is_inline())
+    {
+      return;
+    }
+    else if (const std::size_t block_count = dynamic_bitset::blocks(); block_count <= InlineBlockCount)
+    {
+      std::copy_n(block_data_, block_count, inline_blocks_.data());
+      dynamic_bitset::deallocate();
+      block_data_ = inline_blocks_.data();
+      capacity_ = InlineBlockCount;
+    }
+    else if (block_count < capacity_)
+    {
+      dynamic_bitset::reallocate(block_count);
+    }
   }
 
+  /**
+   * @brief Sets size to zero, retaining storage
+   */
+  void clear() { bit_count_ = 0; }
+
+  /**
+   * @brief Sets size to zero and releases any allocated storage
+   */
   void release()
   {
     dynamic_bitset::deallocate();
-    dynamic_bitset::clear();
-    block_data_ = nullptr;
+    block_data_ = inline_blocks_.data();
+    capacity_ = InlineBlockCount;
+    bit_count_ = 0;
   }
 
-  void fill(const bool state) { dynamic_bitset::fill(0, block_count_, bits::default_block<BlockT>(state)); }
+  void fill(const bool state) { dynamic_bitset::fill(0, dynamic_bitset::blocks(), bits::default_block<BlockT>(state)); }
 
-  void set(const std::size_t bit) const
+  void set(const std::size_t bit)
   {
     bits::set(block_data_[bits::whole_blocks<BlockT>(bit)], bits::remaining<BlockT>(bit));
   }
 
-  void flip(const std::size_t bit) const
+  void flip(const std::size_t bit)
   {
     bits::flip(block_data_[bits::whole_blocks<BlockT>(bit)], bits::remaining<BlockT>(bit));
   }
 
-  void clear(const std::size_t bit) const
+  void clear(const std::size_t bit)
   {
     bits::clear(block_data_[bits::whole_blocks<BlockT>(bit)], bits::remaining<BlockT>(bit));
   }
 
+  /**
+   * @brief Sets all bits in the range [first, last) high
+   */
+  void set(const std::size_t first, const std::size_t last)
+  {
+    dynamic_bitset::apply_range(first, last, [](BlockT& block, const BlockT mask) { block |= mask; });
+  }
+
+  /**
+   * @brief Clears all bits in the range [first, last)
+   */
+  void clear(const std::size_t first, const std::size_t last)
+  {
+    dynamic_bitset::apply_range(first, last, [](BlockT& block, const BlockT mask) { block &= ~mask; });
+  }
+
+  /**
+   * @brief Flips all bits in the range [first, last)
+   */
+  void flip(const std::size_t first, const std::size_t last)
+  {
+    dynamic_bitset::apply_range(first, last, [](BlockT& block, const BlockT mask) { block ^= mask; });
+  }
+
   [[nodiscard]] constexpr bool test(const std::size_t bit) const
   {
     return bits::check(block_data_[bits::whole_blocks<BlockT>(bit)], bits::remaining<BlockT>(bit));
   }
 
+  /**
+   * @brief Returns the number of bits set high
+   */
   [[nodiscard]] std::size_t count() const
   {
-    if (block_data_ == nullptr)
-    {
-      return 0;
-    }
+    const std::size_t n = dynamic_bitset::blocks();
     std::size_t bit_count = 0;
-    for (std::size_t i = 0; i < block_count_; ++i)
+    for (std::size_t i = 0; i < n; ++i)
     {
-      bit_count += bits::count(block_data_[i]);
+      bit_count += bits::count(dynamic_bitset::active_block(i, n));
     }
     return bit_count;
   }
 
+  /**
+   * @brief Returns \c true if any bit is set high
+   */
+  [[nodiscard]] bool any() const
+  {
+    const std::size_t n = dynamic_bitset::blocks();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      if (bits::any(dynamic_bitset::active_block(i, n)))
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Returns \c true if no bits are set high
+   */
+  [[nodiscard]] bool none() const { return !dynamic_bitset::any(); }
+
+  /**
+   * @brief Returns the index of the lowest bit set high, or \c npos if no bits are set
+   */
+  [[nodiscard]] std::size_t find_first() const { return dynamic_bitset::find_from(0); }
+
+  /**
+   * @brief Returns the index of the lowest bit set high after \c bit, or \c npos if there is no such bit
+   */
+  [[nodiscard]] std::size_t find_next(const std::size_t bit) const
+  {
+    return (bit + 1 < bit_count_) ? dynamic_bitset::find_from(bit + 1) : npos;
+  }
+
+  /**
+   * @brief Forward iterator over the indices of bits which are set high
+   */
+  class set_bit_iterator
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = std::size_t;
+
+    set_bit_iterator(const dynamic_bitset* bitset, const std::size_t block_index) :
+        bitset_{bitset},
+        block_index_{block_index},
+        block_count_{bitset->blocks()},
+        current_{(block_index < block_count_) ? bitset->active_block(block_index, block_count_) : bits::zero<BlockT>()}
+    {
+      set_bit_iterator::skip_empty();
+    }
+
+    std::size_t operator*() const { return block_index_ * bits_per_block + bits::first(current_); }
+
+    set_bit_iterator& operator++()
+    {
+      current_ = bits::clear_first(current_);
+      set_bit_iterator::skip_empty();
+      return *this;
+    }
+
+    set_bit_iterator operator++(int)
+    {
+      auto prev = *this;
+      ++(*this);
+      return prev;
+    }
+
+    bool operator==(const set_bit_iterator& other) const
+    {
+      return block_index_ == other.block_index_ and current_ == other.current_;
+    }
+
+    bool operator!=(const set_bit_iterator& other) const { return !this->operator==(other); }
+
+  private:
+    void skip_empty()
+    {
+      while (bits::none(current_) and ++block_index_ < block_count_)
+      {
+        current_ = bitset_->active_block(block_index_, block_count_);
+      }
+      block_index_ = std::min(block_index_, block_count_);
+    }
+
+    const dynamic_bitset* bitset_;
+    std::size_t block_index_;
+    std::size_t block_count_;
+    BlockT current_;
+  };
+
+  /**
+   * @brief Range over the indices of bits which are set high, in ascending order
+   */
+  struct set_bit_range
+  {
+    set_bit_iterator first;
+    set_bit_iterator last;
+
+    set_bit_iterator begin() const { return first; }
+    set_bit_iterator end() const { return last; }
+  };
+
+  /**
+   * @brief Returns a range over the indices of bits which are set high
+   */
+  [[nodiscard]] set_bit_range set_bits() const
+  {
+    return {set_bit_iterator{this, 0}, set_bit_iterator{this, dynamic_bitset::blocks()}};
+  }
+
+  /**
+   * @brief Bitwise AND with another bitset; bits beyond the size of \c other are cleared
+   */
+  template <typename OtherAllocT, std::size_t OtherInlineBlockCount>
+  dynamic_bitset& operator&=(const dynamic_bitset<BlockT, OtherAllocT, OtherInlineBlockCount>& other)
+  {
+    const std::size_t n = dynamic_bitset::blocks();
+    const std::size_t m = std::min(n, other.blocks());
+    // Operands may be the same bitset (e.g. a &= a), so lhs and rhs are allowed to alias
+    BlockT* const lhs = block_data_;
+    const BlockT* const rhs = other.block_data();
+    for (std::size_t i = 0; i < m; ++i)
+    {
+      lhs[i] &= rhs[i];
+    }
+    if (m > 0 and m == other.blocks())
+    {
+      lhs[m - 1] &= other.tail_mask();
+    }
+    dynamic_bitset::fill(m, n, bits::zero<BlockT>());
+    return *this;
+  }
+
+  /**
+   * @brief Bitwise OR with another bitset; bits beyond the size of this bitset are ignored
+   */
+  template <typename OtherAllocT, std::size_t OtherInlineBlockCount>
+  dynamic_bitset& operator|=(const dynamic_bitset<BlockT, OtherAllocT, OtherInlineBlockCount>& other)
+  {
+    const std::size_t m = std::min(dynamic_bitset::blocks(), other.blocks());
+    BlockT* const lhs = block_data_;
+    const BlockT* const rhs = other.block_data();
+    for (std::size_t i = 0; i + 1 < m; ++i)
+    {
+      lhs[i] |= rhs[i];
+    }
+    if (m > 0)
+    {
+      lhs[m - 1] |= (m == other.blocks()) ? (rhs[m - 1] & other.tail_mask()) : rhs[m - 1];
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Bitwise XOR with another bitset; bits beyond the size of this bitset are ignored
+   */
+  template <typename OtherAllocT, std::size_t OtherInlineBlockCount>
+  dynamic_bitset& operator^=(const dynamic_bitset<BlockT, OtherAllocT, OtherInlineBlockCount>& other)
+  {
+    const std::size_t m = std::min(dynamic_bitset::blocks(), other.blocks());
+    BlockT* const lhs = block_data_;
+    const BlockT* const rhs = other.block_data();
+    for (std::size_t i = 0; i + 1 < m; ++i)
+    {
+      lhs[i] ^= rhs[i];
+    }
+    if (m > 0)
+    {
+      lhs[m - 1] ^= (m == other.blocks()) ? (rhs[m - 1] & other.tail_mask()) : rhs[m - 1];
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Clears all bits which are set high in \c other
+   */
+  template <typename OtherAllocT, std::size_t OtherInlineBlockCount>
+  dynamic_bitset& reset(const dynamic_bitset<BlockT, OtherAllocT, OtherInlineBlockCount>& other)
+  {
+    const std::size_t m = std::min(dynamic_bitset::blocks(), other.blocks());
+    BlockT* const lhs = block_data_;
+    const BlockT* const rhs = other.block_data();
+    for (std::size_t i = 0; i + 1 < m; ++i)
+    {
+      lhs[i] &= ~rhs[i];
+    }
+    if (m > 0)
+    {
+      lhs[m - 1] &= ~((m == other.blocks()) ? (rhs[m - 1] & other.tail_mask()) : rhs[m - 1]);
+    }
+    return *this;
+  }
+
   [[nodiscard]] constexpr bool operator[](const std::size_t bit) const { return dynamic_bitset::test(bit); }
 
   [[nodiscard]] const_block_return_t block(const std::size_t block_index) const { return block_data_[block_index]; }
 
   [[nodiscard]] constexpr std::size_t size() const { return bit_count_; }
 
-  [[nodiscard]] constexpr std::size_t min_block_count() { return bits::min_blocks<BlockT>(bit_count_); }
-
   [[nodiscard]] constexpr BlockT* block_data() { return block_data_; }
 
   [[nodiscard]] constexpr const BlockT* block_data() const { return block_data_; }
 
-  [[nodiscard]] constexpr std::size_t blocks() const { return block_count_; }
+  /**
+   * @brief Returns the number of leading blocks which hold bits in the range [0, size())
+   */
+  [[nodiscard]] constexpr std::size_t blocks() const { return bits::min_blocks<BlockT>(bit_count_); }
+
+  /**
+   * @brief Returns the number of blocks which can be held without further allocation
+   */
+  [[nodiscard]] constexpr std::size_t capacity() const { return capacity_; }
+
+  /**
+   * @brief Returns \c true if blocks are held in inline storage, rather than allocated storage
+   */
+  [[nodiscard]] constexpr bool is_inline() const { return block_data_ == inline_blocks_.data(); }
+
+  [[nodiscard]] allocator_type get_allocator() const { return allocator_; }
+
+  /**
+   * @brief Returns mask of bits within the last active block which are in the range [0, size())
+   */
+  [[nodiscard]] constexpr BlockT tail_mask() const
+  {
+    const std::size_t tail_bits = bits::remaining<BlockT>(bit_count_);
+    return (tail_bits == 0) ? bits::all<BlockT>() : bits::make_mask_first_n<BlockT>(tail_bits);
+  }
 
 private:
+  /// Returns active block at \c index with bits beyond size() masked off; \c n is the active block count
+  constexpr BlockT active_block(const std::size_t index, const std::size_t n) const
+  {
+    return (index + 1 == n) ? (block_data_[index] & dynamic_bitset::tail_mask()) : block_data_[index];
+  }
+
+  std::size_t find_from(const std::size_t bit) const
+  {
+    const std::size_t n = dynamic_bitset::blocks();
+    std::size_t block_index = bits::whole_blocks<BlockT>(bit);
+    if (block_index >= n)
+    {
+      return npos;
+    }
+
+    // Ignore bits before 'bit' in the first block searched
+    BlockT block = dynamic_bitset::active_block(block_index, n) & bits::make_mask_from<BlockT>(bits::remaining<BlockT>(bit));
+    while (bits::none(block))
+    {
+      if (++block_index == n)
+      {
+        return npos;
+      }
+      block = dynamic_bitset::active_block(block_index, n);
+    }
+    return block_index * bits_per_block + bits::first(block);
+  }
+
+  template <typename BlockOpT> void apply_range(const std::size_t first, std::size_t last, BlockOpT block_op)
+  {
+    last = std::min(last, bit_count_);
+    if (first >= last)
+    {
+      return;
+    }
+
+    const std::size_t first_block = bits::whole_blocks<BlockT>(first);
+    const std::size_t last_block = bits::whole_blocks<BlockT>(last - 1);
+    const BlockT first_mask = bits::make_mask_from<BlockT>(bits::remaining<BlockT>(first));
+    const BlockT last_mask = bits::make_mask_first_n<BlockT>(bits::remaining<BlockT>(last - 1) + 1);
+
+    if (first_block == last_block)
+    {
+      block_op(block_data_[first_block], first_mask & last_mask);
+      return;
+    }
+
+    block_op(block_data_[first_block], first_mask);
+    for (std::size_t i = first_block + 1; i < last_block; ++i)
+    {
+      block_op(block_data_[i], bits::all<BlockT>());
+    }
+    block_op(block_data_[last_block], last_mask);
+  }
+
   void fill(const std::size_t first, const std::size_t last, const BlockT state)
   {
     for (std::size_t i = first; i < last; ++i)
@@ -152,51 +565,117 @@ private:
     }
   }
 
-  void allocate(const std::size_t new_block_count)
+  /// Copies size and active blocks from another bitset, allocating if needed
+  void assign(const dynamic_bitset& other)
   {
-    auto* const new_block_data = allocator_.allocate(new_block_count);
-    block_data_ = new_block_data;
-    block_count_ = new_block_count;
+    bit_count_ = 0;
+    dynamic_bitset::reserve(other.bit_count_);
+    bit_count_ = other.bit_count_;
+    std::copy_n(other.block_data_, other.blocks(), block_data_);
   }
 
-  void reallocate(const std::size_t new_block_count)
+  /// Takes storage from another bitset, leaving it empty; allocators must be equal
+  void take(dynamic_bitset& other)
   {
-    auto* const new_block_data = allocator_.allocate(new_block_count);
-    if (block_data_ != nullptr)
+    if (other.is_inline())
+    {
+      std::copy_n(other.block_data_, other.blocks(), inline_blocks_.data());
+    }
+    else
     {
-      std::memcpy(new_block_data, block_data_, sizeof(BlockT) * block_count_);
-      allocator_.deallocate(block_data_, block_count_);
+      block_data_ = other.block_data_;
+      capacity_ = other.capacity_;
+      other.block_data_ = other.inline_blocks_.data();
+      other.capacity_ = InlineBlockCount;
     }
+    bit_count_ = other.bit_count_;
+    other.bit_count_ = 0;
+  }
+
+  void reallocate(const std::size_t new_capacity)
+  {
+    auto* const new_block_data = allocator_traits::allocate(allocator_, new_capacity);
+    std::copy_n(block_data_, dynamic_bitset::blocks(), new_block_data);
+    dynamic_bitset::deallocate();
     block_data_ = new_block_data;
-    block_count_ = new_block_count;
+    capacity_ = new_capacity;
   }
 
   void deallocate()
   {
-    if (block_data_ == nullptr)
+    if (dynamic_bitset::is_inline())
     {
       return;
     }
-    allocator_.deallocate(block_data_, block_count_);
+    allocator_traits::deallocate(allocator_, block_data_, capacity_);
   }
 
-  BlockT* block_data_ = nullptr;
-  std::size_t block_count_ = 0;
-  std::size_t bit_count_ = 0;
+  /// Storage used for small bitsets; declared first so that it is initialized before block_data_
+  std::array<BlockT, InlineBlockCount> inline_blocks_;
+  /// Active block storage; points to inline_blocks_ or allocated storage
+  BlockT* block_data_;
+  /// Number of blocks available at block_data_
+  std::size_t capacity_;
+  /// Number of bits
+  std::size_t bit_count_;
+  /// Allocator used for storage beyond inline_blocks_
   Alloc allocator_;
 };
 
-template <typename BlockT, typename LAllocT, typename RAllocT>
-constexpr bool operator==(const dynamic_bitset<BlockT, LAllocT>& lhs, const dynamic_bitset<BlockT, RAllocT>& rhs)
+template <typename BlockT, typename LAllocT, std::size_t LN, typename RAllocT, std::size_t RN>
+constexpr bool operator==(const dynamic_bitset<BlockT, LAllocT, LN>& lhs, const dynamic_bitset<BlockT, RAllocT, RN>& rhs)
 {
-  return (lhs.size() == rhs.size()) and
-    (std::memcmp(lhs.block_data(), rhs.block_data(), sizeof(BlockT) * lhs.blocks()) == 0);
+  if (lhs.size() != rhs.size())
+  {
+    return false;
+  }
+  else if (const std::size_t n = lhs.blocks(); n == 0)
+  {
+    return true;
+  }
+  else
+  {
+    return (std::memcmp(lhs.block_data(), rhs.block_data(), sizeof(BlockT) * (n - 1)) == 0) and
+      (((lhs.block_data()[n - 1] ^ rhs.block_data()[n - 1]) & lhs.tail_mask()) == 0);
+  }
 }
 
-template <typename BlockT, typename LAllocT, typename RAllocT>
-constexpr bool operator!=(const dynamic_bitset<BlockT, LAllocT>& lhs, const dynamic_bitset<BlockT, RAllocT>& rhs)
+template <typename BlockT, typename LAllocT, std::size_t LN, typename RAllocT, std::size_t RN>
+constexpr bool operator!=(const dynamic_bitset<BlockT, LAllocT, LN>& lhs, const dynamic_bitset<BlockT, RAllocT, RN>& rhs)
 {
   return !operator==(lhs, rhs);
 }
 
+template <typename BlockT, typename LAllocT, std::size_t LN, typename RAllocT, std::size_t RN>
+dynamic_bitset<BlockT, LAllocT, LN>
+operator&(dynamic_bitset<BlockT, LAllocT, LN> lhs, const dynamic_bitset<BlockT, RAllocT, RN>& rhs)
+{
+  return std::move(lhs &= rhs);
+}
+
+template <typename BlockT, typename LAllocT, std::size_t LN, typename RAllocT, std::size_t RN>
+dynamic_bitset<BlockT, LAllocT, LN>
+operator|(dynamic_bitset<BlockT, LAllocT, LN> lhs, const dynamic_bitset<BlockT, RAllocT, RN>& rhs)
+{
+  return std::move(lhs |= rhs);
+}
+
+template <typename BlockT, typename LAllocT, std::size_t LN, typename RAllocT, std::size_t RN>
+dynamic_bitset<BlockT, LAllocT, LN>
+operator^(dynamic_bitset<BlockT, LAllocT, LN> lhs, const dynamic_bitset<BlockT, RAllocT, RN>& rhs)
+{
+  return std::move(lhs ^= rhs);
+}
+
+namespace pmr
+{
+
+/**
+ * @brief dynamic_bitset which allocates from a std::pmr::memory_resource
+ */
+template <typename BlockT, std::size_t InlineBlockCount = 2>
+using dynamic_bitset = ::tyl::dynamic_bitset<BlockT, std::pmr::polymorphic_allocator<BlockT>, InlineBlockCount>;
+
+}  // namespace pmr
+
 }  // namespace tyl
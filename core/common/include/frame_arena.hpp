@@ -0,0 +1,257 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file frame_arena.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+
+#if defined(ADDRESS_SANITIZER) || defined(__SANITIZE_ADDRESS__)
+#include <sanitizer/asan_interface.h>
+#define TYL_FRAME_ARENA_POISON(ptr, size) ASAN_POISON_MEMORY_REGION(ptr, size)
+#define TYL_FRAME_ARENA_UNPOISON(ptr, size) ASAN_UNPOISON_MEMORY_REGION(ptr, size)
+#else
+#define TYL_FRAME_ARENA_POISON(ptr, size) (void)0
+#define TYL_FRAME_ARENA_UNPOISON(ptr, size) (void)0
+#endif  // ADDRESS_SANITIZER
+
+namespace tyl
+{
+
+/**
+ * @brief Linear (bump) allocator for data which only lives until the end of a frame
+ *
+ *        Allocations take the next free bytes of one block, and are never freed individually; everything is released
+ *        at once by \c reset, at the end of each frame. Allocations which do not fit go to overflow blocks from the
+ *        upstream resource, after which \c reset grows the main block to fit, so that the arena stops touching
+ *        upstream once frames settle into a steady state.
+ *
+ *        The arena is itself a <code>std::pmr::memory_resource</code>, so it may back any pmr container:
+ *
+ * @code{.cpp}
+ *        std::pmr::vector<EntityID> visible{&frame_arena};
+ * @endcode
+ *
+ *        Released memory is filled with kPoisonByte in debug builds, and poisoned in ASan builds, so that use of data
+ *        from a previous frame is caught.
+ *
+ * @note allocation is thread-safe; \c reset must not be called while other threads may allocate
+ */
+class FrameArena final : public std::pmr::memory_resource
+{
+public:
+  /// Default size of main block, in bytes
+  static constexpr std::size_t kDefaultCapacity = 1UL << 20;
+
+  /// Value written over released memory in debug builds
+  static constexpr unsigned char kPoisonByte = 0xCD;
+
+  explicit FrameArena(
+    const std::size_t capacity = kDefaultCapacity,
+    std::pmr::memory_resource* const upstream = std::pmr::new_delete_resource()) :
+      upstream_{upstream}, capacity_{capacity}, buffer_{allocate_block(capacity_)}
+  {
+    TYL_FRAME_ARENA_POISON(buffer_, capacity_);
+  }
+
+  FrameArena(FrameArena&& other) = delete;
+
+  FrameArena& operator=(FrameArena&& other) = delete;
+
+  ~FrameArena() override
+  {
+    release_overflow();
+    TYL_FRAME_ARENA_UNPOISON(buffer_, capacity_);
+    upstream_->deallocate(buffer_, capacity_, kBlockAlignment);
+  }
+
+  /**
+   * @brief Releases all allocations, growing the main block first if any allocation overflowed it
+   */
+  void reset()
+  {
+    const std::size_t used = offset_.load(std::memory_order_relaxed);
+    if (overflow_ == nullptr)
+    {
+      // Padding between allocations is still poisoned, since only the bytes requested are unpoisoned on allocation
+      TYL_FRAME_ARENA_UNPOISON(buffer_, used);
+#ifndef NDEBUG
+      std::memset(buffer_, kPoisonByte, used);
+#endif  // NDEBUG
+      TYL_FRAME_ARENA_POISON(buffer_, used);
+    }
+    else
+    {
+      // Sized so that a frame like this one would not have overflowed
+      const std::size_t grown_capacity = capacity_ + overflow_bytes_;
+      release_overflow();
+      TYL_FRAME_ARENA_UNPOISON(buffer_, capacity_);
+      upstream_->deallocate(buffer_, capacity_, kBlockAlignment);
+      capacity_ = grown_capacity;
+      buffer_ = allocate_block(capacity_);
+      TYL_FRAME_ARENA_POISON(buffer_, capacity_);
+    }
+    offset_.store(0, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Returns size of main block, in bytes
+   */
+  [[nodiscard]] std::size_t capacity() const { return capacity_; }
+
+  /**
+   * @brief Returns number of bytes allocated since the last reset, including alignment padding
+   */
+  [[nodiscard]] std::size_t used() const
+  {
+    std::lock_guard lock{overflow_mutex_};
+    return offset_.load(std::memory_order_relaxed) + overflow_bytes_;
+  }
+
+  /**
+   * @brief Returns true if any allocation since the last reset did not fit in the main block
+   */
+  [[nodiscard]] bool overflowed() const
+  {
+    std::lock_guard lock{overflow_mutex_};
+    return overflow_ != nullptr;
+  }
+
+private:
+  /// Alignment of all blocks
+  static constexpr std::size_t kBlockAlignment = alignof(std::max_align_t);
+
+  /// Allocations are padded to whole ASan shadow granules, so that concurrent poisoning never shares a granule
+  static constexpr std::size_t kGranule = 8;
+
+  /**
+   * @brief Header at the start of each overflow block
+   */
+  struct Overflow
+  {
+    /// Block allocated before this one
+    Overflow* previous;
+    /// Size of whole block, including this header
+    std::size_t size;
+    /// Offset of next free byte, from the start of the block
+    std::size_t offset;
+  };
+
+  static constexpr std::size_t align_up(const std::size_t value, const std::size_t alignment)
+  {
+    return (value + alignment - 1) & ~(alignment - 1);
+  }
+
+  /// Returns offset of the first address at or after <code>base + offset</code> with the given alignment
+  static std::size_t aligned_offset(const std::byte* const base, const std::size_t offset, const std::size_t alignment)
+  {
+    const auto address = reinterpret_cast<std::uintptr_t>(base) + offset;
+    return offset + (align_up(address, alignment) - address);
+  }
+
+  std::byte* allocate_block(const std::size_t size)
+  {
+    return static_cast<std::byte*>(upstream_->allocate(size, kBlockAlignment));
+  }
+
+  void* do_allocate(const std::size_t bytes, const std::size_t alignment) override
+  {
+    const std::size_t padded_alignment = std::max(alignment, kGranule);
+    const std::size_t padded_bytes = align_up(std::max<std::size_t>(bytes, 1), kGranule);
+
+    std::size_t offset = offset_.load(std::memory_order_relaxed);
+    while (true)
+    {
+      const std::size_t begin = aligned_offset(buffer_, offset, padded_alignment);
+      const std::size_t end = begin + padded_bytes;
+      if (end > capacity_)
+      {
+        return allocate_overflow(padded_bytes, padded_alignment);
+      }
+      else if (offset_.compare_exchange_weak(offset, end, std::memory_order_relaxed))
+      {
+        TYL_FRAME_ARENA_UNPOISON(buffer_ + begin, bytes);
+        return buffer_ + begin;
+      }
+    }
+  }
+
+  void do_deallocate(void* const ptr, const std::size_t bytes, const std::size_t alignment) override {}
+
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+  void* allocate_overflow(const std::size_t bytes, const std::size_t alignment)
+  {
+    std::lock_guard lock{overflow_mutex_};
+
+    const auto try_allocate = [this, bytes, alignment]() -> void* {
+      auto* const base = reinterpret_cast<std::byte*>(overflow_);
+      const std::size_t begin = aligned_offset(base, overflow_->offset, alignment);
+      if (begin + bytes > overflow_->size)
+      {
+        return nullptr;
+      }
+      overflow_bytes_ += (begin + bytes) - overflow_->offset;
+      overflow_->offset = begin + bytes;
+      return base + begin;
+    };
+
+    if (overflow_ != nullptr)
+    {
+      if (void* const ptr = try_allocate(); ptr != nullptr)
+      {
+        return ptr;
+      }
+    }
+
+    const std::size_t header_size = align_up(sizeof(Overflow), kBlockAlignment);
+    const std::size_t size = std::max(capacity_, header_size + bytes + alignment);
+    overflow_ = new (allocate_block(size)) Overflow{overflow_, size, header_size};
+    return try_allocate();
+  }
+
+  void release_overflow()
+  {
+    while (overflow_ != nullptr)
+    {
+      auto* const previous = overflow_->previous;
+      const std::size_t size = overflow_->size;
+      overflow_->~Overflow();
+      upstream_->deallocate(overflow_, size, kBlockAlignment);
+      overflow_ = previous;
+    }
+    overflow_bytes_ = 0;
+  }
+
+  /// Resource which provides blocks
+  std::pmr::memory_resource* upstream_;
+
+  /// Size of main block, in bytes
+  std::size_t capacity_;
+
+  /// Main block
+  std::byte* buffer_;
+
+  /// Offset of next free byte in main block; bumped by allocating threads
+  std::atomic<std::size_t> offset_ = 0;
+
+  /// Guards overflow blocks
+  mutable std::mutex overflow_mutex_;
+
+  /// Most recently allocated overflow block
+  Overflow* overflow_ = nullptr;
+
+  /// Bytes taken from overflow blocks, including alignment padding
+  std::size_t overflow_bytes_ = 0;
+};
+
+}  // namespace tyl
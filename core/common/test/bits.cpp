@@ -0,0 +1,52 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file bits.cpp
+ */
+
+// C++ Standard Library
+#include <cstdint>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Tyl
+#include <tyl/bits.hpp>
+
+using namespace tyl;
+
+TEST(Bits, Count)
+{
+  static_assert(bits::count(std::uint64_t{0}) == 0);
+  static_assert(bits::count(std::uint64_t{0b1011}) == 3);
+  ASSERT_EQ(bits::count(bits::all<std::uint64_t>()), 64UL);
+  ASSERT_EQ(bits::count(bits::all<std::uint8_t>()), 8UL);
+}
+
+TEST(Bits, CountSigned)
+{
+  ASSERT_EQ(bits::count(std::int32_t{-1}), 32UL);
+  ASSERT_EQ(bits::count(std::int8_t{-128}), 1UL);
+}
+
+TEST(Bits, First)
+{
+  static_assert(bits::first(std::uint64_t{1}) == 0);
+  ASSERT_EQ(bits::first(std::uint64_t{0b1000}), 3UL);
+  ASSERT_EQ(bits::first(std::uint64_t{1} << 63), 63UL);
+  ASSERT_EQ(bits::first(std::uint8_t{0b10000000}), 7UL);
+  ASSERT_EQ(bits::first(std::uint32_t{0}), 32UL);
+}
+
+TEST(Bits, ClearFirst)
+{
+  ASSERT_EQ(bits::clear_first(std::uint32_t{0b1100}), 0b1000U);
+  ASSERT_EQ(bits::clear_first(std::uint32_t{0}), 0U);
+}
+
+TEST(Bits, MakeMaskFrom)
+{
+  ASSERT_EQ(bits::make_mask_from<std::uint8_t>(0), 0b11111111);
+  ASSERT_EQ(bits::make_mask_from<std::uint8_t>(3), 0b11111000);
+  ASSERT_EQ(bits::make_mask_from<std::uint64_t>(63), std::uint64_t{1} << 63);
+}
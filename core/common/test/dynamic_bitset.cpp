@@ -0,0 +1,288 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file dynamic_bitset.cpp
+ */
+
+// C++ Standard Library
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Tyl
+#include <tyl/dynamic_bitset.hpp>
+
+using namespace tyl;
+
+using Bitset = dynamic_bitset<std::uint64_t>;
+
+TEST(DynamicBitset, InitialState)
+{
+  const Bitset low{100, false};
+  ASSERT_EQ(low.size(), 100UL);
+  ASSERT_EQ(low.count(), 0UL);
+  ASSERT_TRUE(low.none());
+
+  const Bitset high{100, true};
+  ASSERT_EQ(high.count(), 100UL);
+  ASSERT_TRUE(high.any());
+}
+
+TEST(DynamicBitset, CountIgnoresBitsBeyondSize)
+{
+  Bitset bitset{70, true};
+  bitset.resize(3);
+  ASSERT_EQ(bitset.count(), 3UL);
+}
+
+TEST(DynamicBitset, SetClearFlipRange)
+{
+  Bitset bitset{200};
+
+  bitset.set(10, 150);
+  ASSERT_EQ(bitset.count(), 140UL);
+  ASSERT_FALSE(bitset.test(9));
+  ASSERT_TRUE(bitset.test(10));
+  ASSERT_TRUE(bitset.test(149));
+  ASSERT_FALSE(bitset.test(150));
+
+  bitset.clear(64, 128);
+  ASSERT_EQ(bitset.count(), 76UL);
+
+  bitset.flip(0, 200);
+  ASSERT_EQ(bitset.count(), 124UL);
+}
+
+TEST(DynamicBitset, RangeWithinSingleBlock)
+{
+  Bitset bitset{64};
+  bitset.set(3, 5);
+  ASSERT_EQ(bitset.count(), 2UL);
+  ASSERT_TRUE(bitset.test(3));
+  ASSERT_TRUE(bitset.test(4));
+}
+
+TEST(DynamicBitset, FindFirstAndNext)
+{
+  Bitset bitset{300};
+  ASSERT_EQ(bitset.find_first(), Bitset::npos);
+
+  bitset.set(5);
+  bitset.set(64);
+  bitset.set(299);
+
+  ASSERT_EQ(bitset.find_first(), 5UL);
+  ASSERT_EQ(bitset.find_next(5), 64UL);
+  ASSERT_EQ(bitset.find_next(64), 299UL);
+  ASSERT_EQ(bitset.find_next(299), Bitset::npos);
+}
+
+TEST(DynamicBitset, SetBitIteration)
+{
+  Bitset bitset{1000};
+  const std::vector<std::size_t> expected{0, 1, 63, 64, 500, 999};
+  for (const auto bit : expected)
+  {
+    bitset.set(bit);
+  }
+
+  std::vector<std::size_t> visited;
+  for (const auto bit : bitset.set_bits())
+  {
+    visited.push_back(bit);
+  }
+  ASSERT_EQ(visited, expected);
+}
+
+TEST(DynamicBitset, SetBitIterationEmpty)
+{
+  const Bitset bitset{128};
+  ASSERT_TRUE(bitset.set_bits().begin() == bitset.set_bits().end());
+}
+
+TEST(DynamicBitset, BitwiseAnd)
+{
+  Bitset lhs{130};
+  Bitset rhs{130};
+  lhs.set(0, 100);
+  rhs.set(50, 130);
+
+  const auto result = lhs & rhs;
+  ASSERT_EQ(result.count(), 50UL);
+  ASSERT_EQ(result.find_first(), 50UL);
+}
+
+TEST(DynamicBitset, BitwiseOr)
+{
+  Bitset lhs{130};
+  Bitset rhs{130};
+  lhs.set(0, 10);
+  rhs.set(120, 130);
+
+  const auto result = lhs | rhs;
+  ASSERT_EQ(result.count(), 20UL);
+}
+
+TEST(DynamicBitset, BitwiseXor)
+{
+  Bitset lhs{130};
+  Bitset rhs{130};
+  lhs.set(0, 100);
+  rhs.set(50, 130);
+
+  const auto result = lhs ^ rhs;
+  ASSERT_EQ(result.count(), 80UL);
+}
+
+TEST(DynamicBitset, BitwiseAndShorterOther)
+{
+  Bitset lhs{200, true};
+  Bitset rhs{70, true};
+
+  lhs &= rhs;
+  ASSERT_EQ(lhs.count(), 70UL);
+}
+
+TEST(DynamicBitset, Reset)
+{
+  Bitset lhs{130, true};
+  Bitset rhs{130};
+  rhs.set(0, 30);
+
+  lhs.reset(rhs);
+  ASSERT_EQ(lhs.count(), 100UL);
+  ASSERT_EQ(lhs.find_first(), 30UL);
+}
+
+TEST(DynamicBitset, BitwiseWithSelf)
+{
+  Bitset bitset{130};
+  bitset.set(10, 120);
+
+  bitset &= bitset;
+  ASSERT_EQ(bitset.count(), 110UL);
+
+  bitset |= bitset;
+  ASSERT_EQ(bitset.count(), 110UL);
+
+  bitset ^= bitset;
+  ASSERT_TRUE(bitset.none());
+
+  bitset.set(10, 120);
+  bitset.reset(bitset);
+  ASSERT_TRUE(bitset.none());
+}
+
+TEST(DynamicBitset, Equality)
+{
+  Bitset lhs{70, true};
+  Bitset rhs{70};
+  ASSERT_NE(lhs, rhs);
+
+  rhs.set(0, 70);
+  ASSERT_EQ(lhs, rhs);
+}
+
+TEST(DynamicBitset, SmallBitsetsAreInline)
+{
+  const Bitset bitset{Bitset::inline_block_count * Bitset::bits_per_block, true};
+  ASSERT_TRUE(bitset.is_inline());
+  ASSERT_EQ(bitset.count(), Bitset::inline_block_count * Bitset::bits_per_block);
+}
+
+TEST(DynamicBitset, ResizeSetsNewBits)
+{
+  Bitset bitset{10};
+  bitset.resize(300, true);
+  ASSERT_EQ(bitset.count(), 290UL);
+  ASSERT_EQ(bitset.find_first(), 10UL);
+
+  bitset.resize(5);
+  bitset.resize(20, false);
+  ASSERT_EQ(bitset.count(), 0UL);
+}
+
+TEST(DynamicBitset, ResizeGrowsGeometrically)
+{
+  Bitset bitset;
+  std::size_t reallocations = 0;
+  std::size_t prev_capacity = bitset.capacity();
+  for (std::size_t bit_count = 1; bit_count <= 100'000; ++bit_count)
+  {
+    bitset.resize(bit_count, true);
+    if (bitset.capacity() != prev_capacity)
+    {
+      ++reallocations;
+      prev_capacity = bitset.capacity();
+    }
+  }
+  ASSERT_EQ(bitset.count(), 100'000UL);
+  ASSERT_LT(reallocations, 16UL);
+}
+
+TEST(DynamicBitset, ShrinkToFitReturnsToInline)
+{
+  Bitset bitset{1000, true};
+  ASSERT_FALSE(bitset.is_inline());
+
+  bitset.resize(10);
+  bitset.shrink_to_fit();
+  ASSERT_TRUE(bitset.is_inline());
+  ASSERT_EQ(bitset.count(), 10UL);
+}
+
+TEST(DynamicBitset, CopyIsIndependent)
+{
+  for (const std::size_t bit_count : {10UL, 1000UL})
+  {
+    Bitset original{bit_count};
+    original.set(1);
+
+    Bitset copied{original};
+    copied.set(2);
+    ASSERT_EQ(original.count(), 1UL);
+    ASSERT_EQ(copied.count(), 2UL);
+
+    Bitset assigned;
+    assigned = original;
+    ASSERT_EQ(assigned, original);
+  }
+}
+
+TEST(DynamicBitset, MoveLeavesSourceEmpty)
+{
+  for (const std::size_t bit_count : {10UL, 1000UL})
+  {
+    Bitset original{bit_count, true};
+
+    Bitset moved{std::move(original)};
+    ASSERT_EQ(moved.count(), bit_count);
+    ASSERT_EQ(original.size(), 0UL);
+
+    Bitset assigned;
+    assigned = std::move(moved);
+    ASSERT_EQ(assigned.count(), bit_count);
+    ASSERT_EQ(moved.size(), 0UL);
+  }
+}
+
+TEST(DynamicBitset, PolymorphicAllocator)
+{
+  std::array<std::byte, 4096> buffer;
+  std::pmr::monotonic_buffer_resource arena{buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+
+  tyl::pmr::dynamic_bitset<std::uint64_t> bitset{1000, true, &arena};
+  ASSERT_FALSE(bitset.is_inline());
+  ASSERT_EQ(bitset.count(), 1000UL);
+  ASSERT_EQ(bitset.get_allocator().resource(), &arena);
+
+  // Copies use the default resource, rather than the source arena
+  const tyl::pmr::dynamic_bitset<std::uint64_t> copied{bitset};
+  ASSERT_EQ(copied.get_allocator().resource(), std::pmr::get_default_resource());
+  ASSERT_EQ(copied, bitset);
+}
@@ -0,0 +1,122 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file dynamic_bitset_benchmark.cpp
+ */
+
+// C++ Standard Library
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+
+// Tyl
+#include <tyl/dynamic_bitset.hpp>
+
+using namespace tyl;
+
+namespace
+{
+
+using Bitset = dynamic_bitset<std::uint64_t>;
+
+/// Number of bits in each benchmarked set, e.g. one bit per entity
+static constexpr std::size_t kBitCount = 1'000'000;
+
+/// Number of times each benchmark body is repeated
+static constexpr std::size_t kIterations = 100;
+
+/// Prevents the compiler from discarding benchmark results
+volatile std::size_t sink;
+
+Bitset make_random(const std::size_t bit_count, const double density, std::mt19937& rng)
+{
+  Bitset bitset{bit_count};
+  std::bernoulli_distribution dist{density};
+  for (std::size_t i = 0; i < bit_count; ++i)
+  {
+    if (dist(rng))
+    {
+      bitset.set(i);
+    }
+  }
+  return bitset;
+}
+
+template <typename BodyT> void run(const char* name, BodyT body)
+{
+  const auto t_start = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i < kIterations; ++i)
+  {
+    sink = body();
+  }
+  const auto t_elapsed = std::chrono::steady_clock::now() - t_start;
+  const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(t_elapsed).count();
+  std::printf("%-32s %12.3f us/iter\n", name, static_cast<double>(ns) / kIterations / 1e3);
+}
+
+}  // namespace
+
+int main()
+{
+  std::mt19937 rng{0};
+
+  const auto sparse = make_random(kBitCount, 0.01, rng);
+  const auto dense = make_random(kBitCount, 0.5, rng);
+  auto target = make_random(kBitCount, 0.5, rng);
+
+  run("count", [&] { return dense.count(); });
+
+  run("and", [&] {
+    target &= dense;
+    return target.blocks();
+  });
+
+  run("or", [&] {
+    target |= sparse;
+    return target.blocks();
+  });
+
+  run("xor", [&] {
+    target ^= dense;
+    return target.blocks();
+  });
+
+  run("set_bits (1% density)", [&] {
+    std::size_t total = 0;
+    for (const auto bit : sparse.set_bits())
+    {
+      total += bit;
+    }
+    return total;
+  });
+
+  run("set_bits (50% density)", [&] {
+    std::size_t total = 0;
+    for (const auto bit : dense.set_bits())
+    {
+      total += bit;
+    }
+    return total;
+  });
+
+  run("find_next (1% density)", [&] {
+    std::size_t total = 0;
+    for (auto bit = sparse.find_first(); bit != Bitset::npos; bit = sparse.find_next(bit))
+    {
+      total += bit;
+    }
+    return total;
+  });
+
+  run("test loop (1% density)", [&] {
+    std::size_t total = 0;
+    for (std::size_t bit = 0; bit < sparse.size(); ++bit)
+    {
+      total += sparse.test(bit) ? bit : 0;
+    }
+    return total;
+  });
+
+  return 0;
+}
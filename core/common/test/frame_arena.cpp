@@ -0,0 +1,174 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file frame_arena.cpp
+ */
+
+// C++ Standard Library
+#include <cstdint>
+#include <memory_resource>
+#include <thread>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Tyl
+#include <tyl/frame_arena.hpp>
+
+using namespace tyl;
+
+namespace
+{
+
+/**
+ * @brief Counts allocations made through it
+ */
+class CountingResource final : public std::pmr::memory_resource
+{
+public:
+  std::size_t allocations = 0;
+
+private:
+  void* do_allocate(const std::size_t bytes, const std::size_t alignment) override
+  {
+    ++allocations;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* const ptr, const std::size_t bytes, const std::size_t alignment) override
+  {
+    std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+}  // namespace
+
+TEST(FrameArena, AllocationsAreAligned)
+{
+  FrameArena arena{1024};
+  for (const std::size_t alignment : {1UL, 2UL, 8UL, 16UL, 64UL})
+  {
+    void* const ptr = arena.allocate(3, alignment);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % alignment, 0UL);
+  }
+  ASSERT_FALSE(arena.overflowed());
+}
+
+TEST(FrameArena, BacksPmrContainers)
+{
+  FrameArena arena{1024};
+  std::pmr::vector<int> values{&arena};
+  for (int i = 0; i < 100; ++i)
+  {
+    values.push_back(i);
+  }
+  ASSERT_EQ(values.size(), 100UL);
+  ASSERT_EQ(values.back(), 99);
+  ASSERT_GT(arena.used(), 100 * sizeof(int));
+}
+
+TEST(FrameArena, ResetReleasesAllocations)
+{
+  FrameArena arena{1024};
+  void* const first = arena.allocate(16, 8);
+  ASSERT_GT(arena.used(), 0UL);
+  arena.reset();
+  ASSERT_EQ(arena.used(), 0UL);
+  ASSERT_EQ(arena.allocate(16, 8), first);
+}
+
+TEST(FrameArena, ResetAfterUnpaddedAllocations)
+{
+  FrameArena arena{1024};
+
+  // Sizes which are not whole granules leave padding between allocations
+  [[maybe_unused]] void* const first = arena.allocate(3, 1);
+  [[maybe_unused]] void* const second = arena.allocate(5, 1);
+  arena.reset();
+  ASSERT_EQ(arena.used(), 0UL);
+}
+
+TEST(FrameArena, OverflowGrowsMainBlockOnReset)
+{
+  CountingResource upstream;
+  FrameArena arena{256, &upstream};
+  ASSERT_EQ(upstream.allocations, 1UL);
+
+  const auto frame = [&arena] {
+    for (int i = 0; i < 8; ++i)
+    {
+      [[maybe_unused]] void* const ptr = arena.allocate(128, 8);
+    }
+  };
+
+  frame();
+  ASSERT_TRUE(arena.overflowed());
+  arena.reset();
+  ASSERT_FALSE(arena.overflowed());
+  ASSERT_GE(arena.capacity(), 8UL * 128UL);
+
+  // Frames like the last one no longer touch upstream
+  const std::size_t allocations = upstream.allocations;
+  for (int i = 0; i < 3; ++i)
+  {
+    frame();
+    ASSERT_FALSE(arena.overflowed());
+    arena.reset();
+  }
+  ASSERT_EQ(upstream.allocations, allocations);
+}
+
+#ifndef NDEBUG
+
+TEST(FrameArena, ResetPoisonsReleasedMemory)
+{
+  FrameArena arena{1024};
+  auto* const bytes = static_cast<unsigned char*>(arena.allocate(16, 8));
+  bytes[0] = 0;
+  arena.reset();
+
+  // Reallocated, so the poisoned memory may be inspected
+  auto* const reused = static_cast<unsigned char*>(arena.allocate(16, 8));
+  ASSERT_EQ(reused, bytes);
+  ASSERT_EQ(reused[0], FrameArena::kPoisonByte);
+}
+
+#endif  // NDEBUG
+
+TEST(FrameArena, ConcurrentAllocationsDoNotOverlap)
+{
+  static constexpr std::size_t kThreads = 4;
+  static constexpr std::size_t kAllocationsPerThread = 256;
+
+  FrameArena arena{kThreads * kAllocationsPerThread * 8};
+  std::vector<std::vector<std::uint64_t*>> allocated(kThreads);
+  {
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < kThreads; ++t)
+    {
+      threads.emplace_back([&arena, &allocated, t] {
+        for (std::size_t i = 0; i < kAllocationsPerThread; ++i)
+        {
+          auto* const value = static_cast<std::uint64_t*>(arena.allocate(sizeof(std::uint64_t), 8));
+          *value = t;
+          allocated[t].push_back(value);
+        }
+      });
+    }
+    for (auto& thread : threads)
+    {
+      thread.join();
+    }
+  }
+
+  for (std::size_t t = 0; t < kThreads; ++t)
+  {
+    for (const auto* const value : allocated[t])
+    {
+      ASSERT_EQ(*value, t);
+    }
+  }
+}
@@ -6,7 +6,10 @@
 #pragma once
 
 // C++ Standard Library
+#include <cstddef>
+#include <memory>
 #include <optional>
+#include <utility>
 
 // EnTT
 #include <entt/entt.hpp>
@@ -17,6 +20,14 @@ namespace tyl
 using EntityID = ::entt::entity;
 using Registry = ::entt::registry;
 
+/**
+ * @brief Handle to a component of type ComponentT, attached to another entity
+ *
+ *        Entity IDs carry a version, so references to destroyed entities are never resolved to recycled ones.
+ *
+ * @note resolved component addresses are not cached; every resolve checks the entity version and makes one storage
+ *       lookup, so that references stay trivially copyable and may be resolved from any number of threads at once
+ */
 template <typename ComponentT> struct Reference
 {
   std::optional<EntityID> id;
@@ -54,31 +65,42 @@ template <typename ComponentT> bool operator!=(const Reference<ComponentT>& ref,
   return ref.id.has_value();
 };
 
-template <typename ComponentT> bool is_valid(Registry& registry, const Reference<ComponentT>& reference)
+/**
+ * @brief Looks up a referenced component with a single storage lookup, checking entity version first
+ */
+template <typename ComponentT> ComponentT* maybe_resolve(Registry& registry, const Reference<ComponentT>& reference)
 {
-  return (reference != nullptr) and registry.template any_of<ComponentT>(*reference.id);
+  return (reference != nullptr and registry.valid(*reference.id))
+    ? registry.template try_get<ComponentT>(*reference.id)
+    : nullptr;
 }
 
-template <typename ComponentT> ComponentT& resolve(Registry& registry, const Reference<ComponentT>& reference)
+template <typename ComponentT>
+const ComponentT* maybe_resolve(const Registry& registry, const Reference<ComponentT>& reference)
 {
-  return registry.template get<ComponentT>(*reference.id);
+  return (reference != nullptr and registry.valid(*reference.id))
+    ? registry.template try_get<ComponentT>(*reference.id)
+    : nullptr;
 }
 
-template <typename ComponentT>
-const ComponentT& resolve(const Registry& registry, const Reference<ComponentT>& reference)
+template <typename ComponentT> bool is_valid(const Registry& registry, const Reference<ComponentT>& reference)
 {
-  return registry.template get<ComponentT>(*reference.id);
+  return maybe_resolve(registry, reference) != nullptr;
 }
 
-template <typename ComponentT> ComponentT* maybe_resolve(Registry& registry, const Reference<ComponentT>& reference)
+template <typename ComponentT> ComponentT& resolve(Registry& registry, const Reference<ComponentT>& reference)
 {
-  return is_valid(registry, reference) ? std::addressof(registry.template get<ComponentT>(*reference.id)) : nullptr;
+  auto* const component = maybe_resolve(registry, reference);
+  ENTT_ASSERT(component != nullptr, "Invalid reference");
+  return *component;
 }
 
 template <typename ComponentT>
-const ComponentT* maybe_resolve(const Registry& registry, const Reference<ComponentT>& reference)
+const ComponentT& resolve(const Registry& registry, const Reference<ComponentT>& reference)
 {
-  return is_valid(registry, reference) ? std::addressof(registry.template get<ComponentT>(*reference.id)) : nullptr;
+  const auto* const component = maybe_resolve(registry, reference);
+  ENTT_ASSERT(component != nullptr, "Invalid reference");
+  return *component;
 }
 
 template <typename... ComponentTs>
@@ -88,4 +110,90 @@ std::size_t copy(const Registry& from_registry, EntityID from_id, Registry& to_r
     ((to_registry.template emplace<ComponentTs>(to_id, from_registry.template get<ComponentTs>(from_id)), 1) + ...);
 }
 
+/**
+ * @brief Component payload shared between entities, such as instances of a prefab (flyweight)
+ *
+ *        Copies share one payload, so that copying costs a reference count increment, regardless of payload size. The
+ *        payload is immutable while shared; editing it through \c edit first copies it, if it is shared (copy-on-write).
+ *        Payloads live on the heap, so their addresses do not change when component storage is moved or sorted.
+ *
+ * @note copies may be made and destroyed on any thread, but \c edit must not race with copies of the same payload
+ */
+template <typename ComponentT> class Shared
+{
+public:
+  Shared() : value_{std::make_shared<ComponentT>()} {}
+
+  explicit Shared(ComponentT value) : value_{std::make_shared<ComponentT>(std::move(value))} {}
+
+  /**
+   * @brief Returns shared payload
+   */
+  [[nodiscard]] const ComponentT& get() const { return *value_; }
+
+  [[nodiscard]] const ComponentT& operator*() const { return *value_; }
+
+  [[nodiscard]] const ComponentT* operator->() const { return value_.get(); }
+
+  /**
+   * @brief Returns payload for editing, which is first copied if it is shared with other components
+   */
+  [[nodiscard]] ComponentT& edit()
+  {
+    if (value_.use_count() > 1)
+    {
+      value_ = std::make_shared<ComponentT>(std::as_const(*value_));
+    }
+    return *value_;
+  }
+
+  /**
+   * @brief Returns true if no other component shares this payload
+   */
+  [[nodiscard]] bool unique() const { return value_.use_count() == 1; }
+
+private:
+  /// Payload, shared with copies until edited
+  std::shared_ptr<ComponentT> value_;
+};
+
+/**
+ * @brief Moves ComponentTs of \c id into Shared components, making \c id a prefab which instances can share them with
+ */
+template <typename... ComponentTs> void share(Registry& registry, EntityID id)
+{
+  ((registry.template emplace<Shared<ComponentTs>>(id, std::move(registry.template get<ComponentTs>(id))),
+    registry.template remove<ComponentTs>(id)),
+   ...);
+}
+
+/**
+ * @brief Adds Shared ComponentTs of prefab \c from_id to \c to_id, without copying their payloads
+ *
+ * @return number of components added
+ */
+template <typename... ComponentTs>
+std::size_t instantiate(const Registry& from_registry, EntityID from_id, Registry& to_registry, EntityID to_id)
+{
+  return copy<Shared<ComponentTs>...>(from_registry, from_id, to_registry, to_id);
+}
+
+/**
+ * @brief Returns ComponentT of \c id, whether it is owned by \c id or Shared with other entities
+ *
+ * @retval nullptr  if \c id has neither
+ */
+template <typename ComponentT> const ComponentT* try_get_owned_or_shared(const Registry& registry, EntityID id)
+{
+  if (const auto* const owned = registry.template try_get<ComponentT>(id); owned != nullptr)
+  {
+    return owned;
+  }
+  else if (const auto* const shared = registry.template try_get<Shared<ComponentT>>(id); shared != nullptr)
+  {
+    return std::addressof(shared->get());
+  }
+  return nullptr;
+}
+
 }  // namespace tyl
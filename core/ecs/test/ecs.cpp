@@ -0,0 +1,151 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ */
+
+// C++ Standard Library
+#include <memory>
+#include <utility>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Tyl
+#include <tyl/ecs.hpp>
+
+using namespace tyl;
+
+namespace
+{
+
+using Tiles = std::vector<int>;
+
+struct Label
+{
+  int value = 0;
+};
+
+}  // namespace
+
+TEST(Reference, ResolvesReferencedComponent)
+{
+  Registry registry;
+  const auto id = registry.create();
+  registry.emplace<Label>(id, Label{1});
+
+  const Reference<Label> reference{id};
+  ASSERT_TRUE(is_valid(registry, reference));
+  ASSERT_EQ(resolve(registry, reference).value, 1);
+  ASSERT_EQ(maybe_resolve(std::as_const(registry), reference), registry.try_get<Label>(id));
+}
+
+TEST(Reference, StaleReferenceDoesNotResolveToRecycledEntity)
+{
+  Registry registry;
+  const auto destroyed_id = registry.create();
+  registry.emplace<Label>(destroyed_id, Label{1});
+  const Reference<Label> stale{destroyed_id};
+  registry.destroy(destroyed_id);
+
+  // New entity reuses the destroyed entity's index, with a newer version
+  const auto recycled_id = registry.create();
+  registry.emplace<Label>(recycled_id, Label{2});
+  ASSERT_EQ(entt::to_entity(recycled_id), entt::to_entity(destroyed_id));
+  ASSERT_NE(recycled_id, destroyed_id);
+
+  ASSERT_FALSE(is_valid(registry, stale));
+  ASSERT_EQ(maybe_resolve(registry, stale), nullptr);
+  ASSERT_EQ(maybe_resolve(std::as_const(registry), stale), nullptr);
+}
+
+TEST(Shared, CopiesSharePayload)
+{
+  const Shared<Tiles> original{Tiles{1, 2, 3}};
+  ASSERT_TRUE(original.unique());
+
+  const auto copy = original;
+  ASSERT_FALSE(original.unique());
+  ASSERT_FALSE(copy.unique());
+  ASSERT_EQ(std::addressof(original.get()), std::addressof(copy.get()));
+}
+
+TEST(Shared, EditCopiesSharedPayload)
+{
+  const Shared<Tiles> original{Tiles{1, 2, 3}};
+  auto copy = original;
+
+  copy.edit().push_back(4);
+  ASSERT_NE(std::addressof(original.get()), std::addressof(copy.get()));
+  ASSERT_EQ(original.get(), (Tiles{1, 2, 3}));
+  ASSERT_EQ(copy.get(), (Tiles{1, 2, 3, 4}));
+  ASSERT_TRUE(original.unique());
+  ASSERT_TRUE(copy.unique());
+}
+
+TEST(Shared, EditKeepsUniquePayload)
+{
+  Shared<Tiles> shared{Tiles{1, 2, 3}};
+  const auto* const payload = std::addressof(shared.get());
+
+  shared.edit().push_back(4);
+  ASSERT_EQ(std::addressof(shared.get()), payload);
+  ASSERT_EQ(*shared, (Tiles{1, 2, 3, 4}));
+}
+
+TEST(Shared, ShareMovesComponentsIntoShared)
+{
+  Registry registry;
+  const auto prefab = registry.create();
+  registry.emplace<Tiles>(prefab, Tiles{1, 2, 3});
+  registry.emplace<Label>(prefab, Label{7});
+
+  share<Tiles, Label>(registry, prefab);
+  ASSERT_FALSE(registry.any_of<Tiles>(prefab));
+  ASSERT_FALSE(registry.any_of<Label>(prefab));
+  ASSERT_EQ(registry.get<Shared<Tiles>>(prefab).get(), (Tiles{1, 2, 3}));
+  ASSERT_EQ(registry.get<Shared<Label>>(prefab)->value, 7);
+}
+
+TEST(Shared, InstantiateSharesPrefabPayloads)
+{
+  Registry registry;
+  const auto prefab = registry.create();
+  registry.emplace<Tiles>(prefab, Tiles{1, 2, 3});
+  share<Tiles>(registry, prefab);
+
+  const auto instance = registry.create();
+  ASSERT_EQ(instantiate<Tiles>(registry, prefab, registry, instance), 1UL);
+
+  const auto& prefab_tiles = registry.get<Shared<Tiles>>(prefab);
+  const auto& instance_tiles = registry.get<Shared<Tiles>>(instance);
+  ASSERT_EQ(std::addressof(prefab_tiles.get()), std::addressof(instance_tiles.get()));
+  ASSERT_FALSE(prefab_tiles.unique());
+
+  // Editing an instance leaves the prefab, and any other instances, as they were
+  registry.get<Shared<Tiles>>(instance).edit().push_back(4);
+  ASSERT_EQ(registry.get<Shared<Tiles>>(prefab).get(), (Tiles{1, 2, 3}));
+  ASSERT_EQ(registry.get<Shared<Tiles>>(instance).get(), (Tiles{1, 2, 3, 4}));
+}
+
+TEST(Shared, TryGetOwnedOrShared)
+{
+  Registry registry;
+
+  const auto owner = registry.create();
+  registry.emplace<Tiles>(owner, Tiles{1});
+
+  const auto sharer = registry.create();
+  registry.emplace<Shared<Tiles>>(sharer, Tiles{2});
+
+  const auto both = registry.create();
+  registry.emplace<Tiles>(both, Tiles{3});
+  registry.emplace<Shared<Tiles>>(both, Tiles{4});
+
+  const auto neither = registry.create();
+
+  const Registry& const_registry = registry;
+  ASSERT_EQ(*try_get_owned_or_shared<Tiles>(const_registry, owner), (Tiles{1}));
+  ASSERT_EQ(*try_get_owned_or_shared<Tiles>(const_registry, sharer), (Tiles{2}));
+  ASSERT_EQ(*try_get_owned_or_shared<Tiles>(const_registry, both), (Tiles{3}));
+  ASSERT_EQ(try_get_owned_or_shared<Tiles>(const_registry, neither), nullptr);
+}
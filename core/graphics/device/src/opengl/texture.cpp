@@ -5,6 +5,7 @@
  */
 
 // C++ Standard Library
+#include <memory>
 #include <tuple>
 
 // Tyl
@@ -521,7 +522,11 @@ Texture::~Texture()
 
 Texture& Texture::operator=(Texture&& other)
 {
-  new (this) Texture{std::move(other)};
+  if (this != std::addressof(other))
+  {
+    this->~Texture();
+    new (this) Texture{std::move(other)};
+  }
   return *this;
 }
 
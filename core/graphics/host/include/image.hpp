@@ -6,6 +6,7 @@
 #pragma once
 
 // C++ Standard Library
+#include <cstddef>
 #include <cstdint>
 #include <filesystem>
 
@@ -110,6 +111,18 @@ public:
     return load(path.string().c_str(), options);
   }
 
+  /**
+   * @brief Loads image from encoded image data in memory to image data on host
+   *
+   * @param data  pointer to encoded image file contents
+   * @param len  length of encoded image data, in bytes
+   * @param options  image loading options
+   *
+   * @return image
+   */
+  [[nodiscard]] static tyl::expected<Image, Error>
+  load(const void* data, const std::size_t len, const ImageOptions& options = ImageOptions{}) noexcept;
+
 private:
   Image(const ImageShape& shape_data, void* const data);
 
@@ -7,6 +7,7 @@
 // C++ Standard Library
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <type_traits>
 
 // STB
@@ -66,6 +67,29 @@ device::TextureChannels image_channel_count_to_texture_mode(const int count)
   return device::TextureChannels::R;
 }
 
+template <typename STBILoadT>
+std::uint8_t* load_with_options(ImageShape& shape, const ImageOptions& options, STBILoadT stbi_load_fn)
+{
+  // Set flag determining whether image should be flipped on load
+  stbi_set_flip_vertically_on_load(options.flags.flip_vertically);
+
+  // Get STBI channel code
+  const int channel_count_forced = channel_mode_to_stbi_enum(options.channel_mode);
+
+  // Load image data and sizing
+  auto* image_data_ptr = stbi_load_fn(&shape.height, &shape.width, &shape.channel_count, channel_count_forced);
+
+  static_assert(std::is_same<decltype(image_data_ptr), std::uint8_t*>(), "Image data not loaded as byte array");
+
+  // Resolve number of channels if channel count was forced with 'options'
+  if ((image_data_ptr != nullptr) and (options.channel_mode != ImageOptions::ChannelMode::Default))
+  {
+    shape.channel_count = channel_count_forced;
+  }
+
+  return image_data_ptr;
+}
+
 }  // namespace anonymous
 
 Image::Image(const ImageShape& shape, void* const data) : shape_{shape}, data_{data} {}
@@ -95,17 +119,11 @@ device::Texture Image::texture(const device::TextureOptions& options) const noex
 
 expected<Image, Image::Error> Image::load(const char* path, const ImageOptions& options) noexcept
 {
-  // Set flag determining whether image should be flipped on load
-  stbi_set_flip_vertically_on_load(options.flags.flip_vertically);
-
-  // Get STBI channel code
-  const int channel_count_forced = channel_mode_to_stbi_enum(options.channel_mode);
-
-  // Load image data and sizing
   ImageShape shape;
-  auto* image_data_ptr = stbi_load(path, &shape.height, &shape.width, &shape.channel_count, channel_count_forced);
-
-  static_assert(std::is_same<decltype(image_data_ptr), std::uint8_t*>(), "Image data not loaded as byte array");
+  auto* const image_data_ptr = load_with_options(
+    shape, options, [path](int* x, int* y, int* channels, int desired_channels) {
+      return stbi_load(path, x, y, channels, desired_channels);
+    });
 
   // Check if image point is valid
   if (image_data_ptr == nullptr)
@@ -113,10 +131,27 @@ expected<Image, Image::Error> Image::load(const char* path, const ImageOptions&
     return unexpected<Error>{Error::kInvalidImageFile};
   }
 
-  // Resolve number of channels if channel count was forced with 'options'
-  if (options.channel_mode != ImageOptions::ChannelMode::Default)
+  return Image{shape, image_data_ptr};
+}
+
+expected<Image, Image::Error> Image::load(const void* data, const std::size_t len, const ImageOptions& options) noexcept
+{
+  if (data == nullptr or len == 0 or len > static_cast<std::size_t>(std::numeric_limits<int>::max()))
   {
-    shape.channel_count = channel_count_forced;
+    return unexpected<Error>{Error::kInvalidImageFile};
+  }
+
+  ImageShape shape;
+  auto* const image_data_ptr = load_with_options(
+    shape, options, [data, len](int* x, int* y, int* channels, int desired_channels) {
+      return stbi_load_from_memory(
+        static_cast<const stbi_uc*>(data), static_cast<int>(len), x, y, channels, desired_channels);
+    });
+
+  // Check if image point is valid
+  if (image_data_ptr == nullptr)
+  {
+    return unexpected<Error>{Error::kInvalidImageFile};
   }
 
   return Image{shape, image_data_ptr};
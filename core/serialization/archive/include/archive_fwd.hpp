@@ -12,7 +12,21 @@ template <typename IArchiveT> class iarchive;
 template <typename OArchiveT> class oarchive;
 template <typename IStreamT> class binary_iarchive;
 template <typename OStreamT> class binary_oarchive;
-template <typename IStreamT> class json_iarchive;
-template <typename OStreamT> class json_oarchive;
+template <typename IStreamT> class compact_binary_iarchive;
+template <typename OStreamT> class compact_binary_oarchive;
+
+/**
+ * @brief Selects how JSON archives represent packets of trivially serializable data
+ */
+enum class json_packet_format
+{
+  /// Trivially serializable data is written field-wise, as with any other object
+  sequence,
+  /// Trivially serializable data is written as packets, encoded as base64 strings
+  base64,
+};
+
+template <typename IStreamT, json_packet_format PacketFormat = json_packet_format::sequence> class json_iarchive;
+template <typename OStreamT, json_packet_format PacketFormat = json_packet_format::sequence> class json_oarchive;
 
 }  // namespace tyl::serialization
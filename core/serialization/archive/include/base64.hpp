@@ -0,0 +1,122 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file base64.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace tyl::serialization
+{
+namespace detail
+{
+
+static constexpr char base64_alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/// Marks characters which are not part of the base64 alphabet
+static constexpr std::uint8_t base64_invalid = 0xFF;
+
+constexpr std::array<std::uint8_t, 256> make_base64_decode_table()
+{
+  std::array<std::uint8_t, 256> table{};
+  for (auto& v : table)
+  {
+    v = base64_invalid;
+  }
+  for (std::uint8_t i = 0; i < 64; ++i)
+  {
+    table[static_cast<std::uint8_t>(base64_alphabet[i])] = i;
+  }
+  return table;
+}
+
+static constexpr auto base64_decode_table = make_base64_decode_table();
+
+}  // namespace detail
+
+/**
+ * @brief Returns number of characters needed to base64-encode \c len bytes, including padding
+ */
+constexpr std::size_t base64_encoded_size(const std::size_t len) { return ((len + 2) / 3) * 4; }
+
+/**
+ * @brief Base64-encodes \c len bytes from \c data
+ *
+ * @param out  destination with room for at least <code>base64_encoded_size(len)</code> characters
+ *
+ * @return one past the last character written
+ */
+inline char* base64_encode(char* out, const void* data, const std::size_t len)
+{
+  const auto* in = static_cast<const std::uint8_t*>(data);
+  const auto* const in_last_triple = in + (len - len % 3);
+
+  for (; in != in_last_triple; in += 3)
+  {
+    const std::uint32_t triple = (std::uint32_t{in[0]} << 16) | (std::uint32_t{in[1]} << 8) | std::uint32_t{in[2]};
+    *out++ = detail::base64_alphabet[(triple >> 18) & 0x3F];
+    *out++ = detail::base64_alphabet[(triple >> 12) & 0x3F];
+    *out++ = detail::base64_alphabet[(triple >> 6) & 0x3F];
+    *out++ = detail::base64_alphabet[triple & 0x3F];
+  }
+
+  if (const std::size_t remaining = len % 3; remaining != 0)
+  {
+    const std::uint32_t triple = (std::uint32_t{in[0]} << 16) | ((remaining == 2) ? (std::uint32_t{in[1]} << 8) : 0);
+    *out++ = detail::base64_alphabet[(triple >> 18) & 0x3F];
+    *out++ = detail::base64_alphabet[(triple >> 12) & 0x3F];
+    *out++ = (remaining == 2) ? detail::base64_alphabet[(triple >> 6) & 0x3F] : '=';
+    *out++ = '=';
+  }
+  return out;
+}
+
+/**
+ * @brief Decodes base64 characters in <code>[first, last)</code> into exactly \c len bytes at \c data
+ *
+ * @return false if input is not valid base64, or does not decode to exactly \c len bytes
+ */
+inline bool base64_decode(void* data, const std::size_t len, const char* first, const char* last)
+{
+  const std::size_t encoded_len = static_cast<std::size_t>(last - first);
+  if (encoded_len != base64_encoded_size(len))
+  {
+    return false;
+  }
+
+  auto* out = static_cast<std::uint8_t*>(data);
+  auto* const out_last = out + len;
+
+  for (; first != last; first += 4)
+  {
+    const std::uint8_t a = detail::base64_decode_table[static_cast<std::uint8_t>(first[0])];
+    const std::uint8_t b = detail::base64_decode_table[static_cast<std::uint8_t>(first[1])];
+    const std::uint8_t c = (first[2] == '=') ? 0 : detail::base64_decode_table[static_cast<std::uint8_t>(first[2])];
+    const std::uint8_t d = (first[3] == '=') ? 0 : detail::base64_decode_table[static_cast<std::uint8_t>(first[3])];
+    if (
+      a == detail::base64_invalid or b == detail::base64_invalid or c == detail::base64_invalid or
+      d == detail::base64_invalid)
+    {
+      return false;
+    }
+
+    const std::uint32_t triple =
+      (std::uint32_t{a} << 18) | (std::uint32_t{b} << 12) | (std::uint32_t{c} << 6) | std::uint32_t{d};
+    *out++ = static_cast<std::uint8_t>(triple >> 16);
+    if (out != out_last)
+    {
+      *out++ = static_cast<std::uint8_t>(triple >> 8);
+    }
+    if (out != out_last)
+    {
+      *out++ = static_cast<std::uint8_t>(triple);
+    }
+  }
+  return true;
+}
+
+}  // namespace tyl::serialization
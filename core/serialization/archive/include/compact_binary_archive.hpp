@@ -0,0 +1,10 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file compact_binary_archive.hpp
+ */
+#pragma once
+
+// Tyl
+#include <tyl/serialization/compact_binary_iarchive.hpp>
+#include <tyl/serialization/compact_binary_oarchive.hpp>
@@ -0,0 +1,202 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file compact_binary_iarchive.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Tyl
+#include <tyl/serialization/iarchive.hpp>
+#include <tyl/serialization/istream.hpp>
+#include <tyl/serialization/packet.hpp>
+#include <tyl/serialization/sorted_packet.hpp>
+#include <tyl/serialization/varint.hpp>
+
+namespace tyl::serialization
+{
+
+struct load_compact_varint;
+struct load_compact_sorted_packet;
+
+/**
+ * @brief Binary input archive which reads output of compact_binary_oarchive
+ */
+template <typename IStreamT> class compact_binary_iarchive : public iarchive<compact_binary_iarchive<IStreamT>>
+{
+  using iarchive_base = iarchive<compact_binary_iarchive<IStreamT>>;
+
+  friend iarchive_base;
+  friend load_compact_varint;
+  friend load_compact_sorted_packet;
+
+public:
+  explicit compact_binary_iarchive(istream<IStreamT>& is) : is_{static_cast<IStreamT*>(std::addressof(is))} {}
+
+  using iarchive_base::operator>>;
+  using iarchive_base::operator&;
+
+private:
+  static constexpr void read_impl(label _)
+  { /* labels are ignored */
+  }
+
+  template <typename IteratorT> constexpr void read_impl(sequence<IteratorT> sequence)
+  {
+    const auto [first, last] = sequence;
+    for (auto itr = first; itr != last; ++itr)
+    {
+      (*this) >> (*itr);
+    }
+  }
+
+  template <typename PointerT> constexpr void read_impl(basic_packet<PointerT> packet)
+  {
+    using value_type = std::remove_pointer_t<PointerT>;
+    if constexpr (std::is_void_v<value_type>)
+    {
+      is_->read(packet.data, packet.len);
+    }
+    else
+    {
+      is_->read(packet.data, packet.len * sizeof(value_type));
+    }
+  }
+
+  template <typename PointerT, std::size_t Len> constexpr void read_impl(basic_packet_fixed_size<PointerT, Len> packet)
+  {
+    using value_type = std::remove_pointer_t<PointerT>;
+    if constexpr (std::is_void_v<value_type>)
+    {
+      is_->read(packet.data, packet.len);
+    }
+    else
+    {
+      is_->read(packet.data, packet.len * sizeof(value_type));
+    }
+  }
+
+  template <typename ValueT> void read_varint(ValueT& value)
+  {
+    using unsigned_type = varint_unsigned_t<ValueT>;
+
+    unsigned_type u = 0;
+    for (unsigned shift = 0; shift < sizeof(unsigned_type) * 8; shift += 7)
+    {
+      std::uint8_t byte = 0;
+      is_->read(&byte, 1);
+      u |= static_cast<unsigned_type>(static_cast<unsigned_type>(byte & 0x7F) << shift);
+      if ((byte & 0x80) == 0)
+      {
+        break;
+      }
+    }
+    value = zigzag_decode<ValueT>(u);
+  }
+
+  template <typename ValueT> void read_sorted_packet(sorted_packet<ValueT> packet)
+  {
+    using unsigned_type = varint_unsigned_t<ValueT>;
+
+    std::size_t encoded_size = 0;
+    read_varint(encoded_size);
+    if (packet.len == 0 and encoded_size == 0)
+    {
+      return;
+    }
+    else if (encoded_size < packet.len or encoded_size > packet.len * varint_max_size)
+    {
+      throw std::runtime_error{"sorted packet has an invalid size"};
+    }
+
+    // Read all encoded bytes at once, so that decoding does not go through the stream per value
+    encoded_.resize(encoded_size);
+    if (is_->read(encoded_.data(), encoded_size) != encoded_size)
+    {
+      throw std::runtime_error{"sorted packet is truncated"};
+    }
+
+    const std::uint8_t* const last = encoded_.data() + encoded_size;
+    unsigned_type u = 0;
+    const std::uint8_t* in = varint_decode(encoded_.data(), last, u);
+    if (in == nullptr)
+    {
+      throw std::runtime_error{"sorted packet is invalid"};
+    }
+    packet.data[0] = zigzag_decode<ValueT>(u);
+
+    auto prev = static_cast<unsigned_type>(packet.data[0]);
+    for (std::size_t i = 1; i < packet.len; ++i)
+    {
+      if (in = varint_decode(in, last, u); in == nullptr)
+      {
+        throw std::runtime_error{"sorted packet is invalid"};
+      }
+      prev = static_cast<unsigned_type>(prev + u);
+      packet.data[i] = static_cast<ValueT>(prev);
+    }
+
+    if (in != last)
+    {
+      throw std::runtime_error{"sorted packet is invalid"};
+    }
+  }
+
+  IStreamT* is_;
+
+  /// Scratch space for decoding sorted packets
+  std::vector<std::uint8_t> encoded_;
+};
+
+template <typename IStreamT> compact_binary_iarchive(istream<IStreamT>& is) -> compact_binary_iarchive<IStreamT>;
+
+struct load_compact_varint
+{
+  template <typename IStreamT, typename ValueT> void operator()(compact_binary_iarchive<IStreamT>& ar, ValueT& value)
+  {
+    ar.read_varint(value);
+  }
+};
+
+struct load_compact_sorted_packet
+{
+  template <typename IStreamT, typename ValueT>
+  void operator()(compact_binary_iarchive<IStreamT>& ar, sorted_packet<ValueT> packet)
+  {
+    ar.read_sorted_packet(packet);
+  }
+};
+
+struct load_compact_trivial
+{
+  template <typename IStreamT, typename ValueT> void operator()(compact_binary_iarchive<IStreamT>& ar, ValueT& value)
+  {
+    ar >> make_packet(std::addressof(value));
+  }
+};
+
+template <typename IStreamT, typename ValueT>
+struct load_impl<compact_binary_iarchive<IStreamT>, ValueT>
+    : std::conditional_t<
+        (is_varint_encodable_v<ValueT> and !load_is_implemented_v<compact_binary_iarchive<IStreamT>, ValueT>),
+        load_compact_varint,
+        std::conditional_t<
+          is_sorted_packet_v<ValueT>,
+          load_compact_sorted_packet,
+          std::conditional_t<
+            (is_trivially_serializable_v<compact_binary_iarchive<IStreamT>, ValueT> and
+             !load_is_implemented_v<compact_binary_iarchive<IStreamT>, ValueT>),
+            load_compact_trivial,
+            load<compact_binary_iarchive<IStreamT>, ValueT>>>>
+{};
+
+template <typename IStreamT> struct archive_uses_varints<compact_binary_iarchive<IStreamT>> : std::true_type
+{};
+
+}  // namespace tyl::serialization
@@ -0,0 +1,176 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file compact_binary_oarchive.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Tyl
+#include <tyl/serialization/oarchive.hpp>
+#include <tyl/serialization/ostream.hpp>
+#include <tyl/serialization/packet.hpp>
+#include <tyl/serialization/sorted_packet.hpp>
+#include <tyl/serialization/varint.hpp>
+
+namespace tyl::serialization
+{
+
+struct save_compact_varint;
+struct save_compact_sorted_packet;
+
+/**
+ * @brief Binary output archive which stores integers compactly
+ *
+ *        Integral and enum values wider than a byte, including container length prefixes, are written as LEB128
+ *        varints; signed values are zigzag-encoded first. Each sorted_packet is written as a byte count followed by
+ *        its first value and the varint differences between successive values. Everything else is written as with
+ *        binary_oarchive. Output must be read back with compact_binary_iarchive.
+ */
+template <typename OStreamT> class compact_binary_oarchive : public oarchive<compact_binary_oarchive<OStreamT>>
+{
+  using oarchive_base = oarchive<compact_binary_oarchive<OStreamT>>;
+
+  friend oarchive_base;
+  friend save_compact_varint;
+  friend save_compact_sorted_packet;
+
+public:
+  explicit compact_binary_oarchive(ostream<OStreamT>& os) : os_{static_cast<OStreamT*>(std::addressof(os))} {}
+
+  using oarchive_base::operator<<;
+  using oarchive_base::operator&;
+
+private:
+  static constexpr void write_impl(const label& _)
+  { /* labels are ignored */
+  }
+
+  template <typename IteratorT> constexpr void write_impl(const sequence<IteratorT>& sequence)
+  {
+    const auto [first, last] = sequence;
+    for (auto itr = first; itr != last; ++itr)
+    {
+      (*this) << (*itr);
+    }
+  }
+
+  template <typename PointerT> constexpr void write_impl(const basic_packet<PointerT>& packet)
+  {
+    using value_type = std::remove_pointer_t<PointerT>;
+    if constexpr (std::is_void_v<value_type>)
+    {
+      os_->write(packet.data, packet.len);
+    }
+    else
+    {
+      os_->write(packet.data, packet.len * sizeof(value_type));
+    }
+  }
+
+  template <typename PointerT, std::size_t Len>
+  constexpr void write_impl(const basic_packet_fixed_size<PointerT, Len>& packet)
+  {
+    using value_type = std::remove_pointer_t<PointerT>;
+    if constexpr (std::is_void_v<value_type>)
+    {
+      os_->write(packet.data, packet.len);
+    }
+    else
+    {
+      os_->write(packet.data, packet.len * sizeof(value_type));
+    }
+  }
+
+  template <typename ValueT> void write_varint(const ValueT value)
+  {
+    std::uint8_t bytes[varint_max_size];
+    const auto* last = varint_encode(bytes, zigzag_encode(value));
+    os_->write(bytes, static_cast<std::size_t>(last - bytes));
+  }
+
+  template <typename ValueT> void write_sorted_packet(const sorted_packet<ValueT>& packet)
+  {
+    using value_type = std::remove_const_t<ValueT>;
+    using unsigned_type = varint_unsigned_t<value_type>;
+
+    if (packet.len == 0)
+    {
+      write_varint(std::size_t{0});
+      return;
+    }
+
+    // Differences are taken modulo the integer width, so that any order of values round-trips
+    encoded_.resize(packet.len * varint_max_size);
+    auto* out = varint_encode(encoded_.data(), zigzag_encode(packet.data[0]));
+    for (std::size_t i = 1; i < packet.len; ++i)
+    {
+      const auto prev = static_cast<unsigned_type>(packet.data[i - 1]);
+      const auto curr = static_cast<unsigned_type>(packet.data[i]);
+      out = varint_encode(out, static_cast<unsigned_type>(curr - prev));
+    }
+
+    const auto encoded_size = static_cast<std::size_t>(out - encoded_.data());
+    write_varint(encoded_size);
+    os_->write(encoded_.data(), encoded_size);
+  }
+
+  OStreamT* os_;
+
+  /// Scratch space for encoding sorted packets
+  std::vector<std::uint8_t> encoded_;
+};
+
+template <typename OStreamT> compact_binary_oarchive(ostream<OStreamT>& os) -> compact_binary_oarchive<OStreamT>;
+
+struct save_compact_varint
+{
+  template <typename OStreamT, typename ValueT>
+  void operator()(compact_binary_oarchive<OStreamT>& ar, const ValueT& value)
+  {
+    ar.write_varint(value);
+  }
+};
+
+struct save_compact_sorted_packet
+{
+  template <typename OStreamT, typename ValueT>
+  void operator()(compact_binary_oarchive<OStreamT>& ar, const sorted_packet<ValueT>& packet)
+  {
+    ar.write_sorted_packet(packet);
+  }
+};
+
+struct save_compact_trivial
+{
+  template <typename OStreamT, typename ValueT>
+  void operator()(compact_binary_oarchive<OStreamT>& ar, const ValueT& value)
+  {
+    ar << make_packet(std::addressof(value));
+  }
+};
+
+template <typename OStreamT, typename ValueT>
+struct save_impl<compact_binary_oarchive<OStreamT>, ValueT>
+    : std::conditional_t<
+        (is_varint_encodable_v<ValueT> and !save_is_implemented_v<compact_binary_oarchive<OStreamT>, ValueT>),
+        save_compact_varint,
+        std::conditional_t<
+          is_sorted_packet_v<ValueT>,
+          save_compact_sorted_packet,
+          std::conditional_t<
+            (is_trivially_serializable_v<compact_binary_oarchive<OStreamT>, ValueT> and
+             !save_is_implemented_v<compact_binary_oarchive<OStreamT>, ValueT>),
+            save_compact_trivial,
+            save<compact_binary_oarchive<OStreamT>, ValueT>>>>
+{};
+
+template <typename OStreamT> struct archive_uses_varints<compact_binary_oarchive<OStreamT>> : std::true_type
+{};
+
+}  // namespace tyl::serialization
@@ -6,6 +6,7 @@
 #pragma once
 
 // C++ Standard Library
+#include <memory_resource>
 #include <type_traits>
 #include <utility>
 
@@ -65,12 +66,30 @@ public:
     return this->derived();
   }
 
+  /**
+   * @brief Returns the memory resource from which loaded pmr containers allocate
+   */
+  std::pmr::memory_resource* memory_resource() const { return memory_resource_; }
+
+  /**
+   * @brief Sets the memory resource from which loaded pmr containers allocate
+   *
+   *        Lets variable-size data be loaded into an arena, such as std::pmr::monotonic_buffer_resource, and released
+   *        all at once. Only pmr containers which use the default memory resource are moved onto this resource.
+   *
+   * @warning resource must outlive all containers loaded from this archive
+   */
+  void set_memory_resource(std::pmr::memory_resource* resource) { memory_resource_ = resource; }
+
   iarchive() = default;
 
 private:
   iarchive(const iarchive&) = default;
 
   static constexpr void read_impl(label _) {}
+
+  /// Memory resource from which loaded pmr containers allocate
+  std::pmr::memory_resource* memory_resource_ = std::pmr::get_default_resource();
 };
 
 }  // namespace tyl::serialization
@@ -6,14 +6,22 @@
 #pragma once
 
 // C++ Standard Library
-#include <cctype>
-#include <sstream>
+#include <algorithm>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 // Tyl
+#include <tyl/serialization/archive_fwd.hpp>
+#include <tyl/serialization/base64.hpp>
 #include <tyl/serialization/iarchive.hpp>
 #include <tyl/serialization/istream.hpp>
 #include <tyl/serialization/named.hpp>
@@ -28,29 +36,51 @@ template <typename ValueT> struct load_json_primitive
 
   template <typename JSONArchiveT> void operator()(JSONArchiveT& ar, ValueT& object)
   {
-    ar.template eat<'{'>();
+    ar.begin_object();
     load<JSONArchiveT, ValueT>{}(ar, object);
-    ar.template eat<'}'>();
+    ar.end_object();
   }
 };
 
-template <typename IStreamT> class json_iarchive : public iarchive<json_iarchive<IStreamT>>
+/**
+ * @brief JSON input archive
+ *
+ *        Stream contents are read in large blocks and tokenized in memory. Object members are matched to labels by
+ *        key, so members may appear in any order; members without a matching label are skipped.
+ *
+ * @tparam PacketFormat  selects whether trivially serializable data is read field-wise, or as base64 packets
+ *
+ * @note stream contents are retained only while they may still be read; bytes before the cursor are dropped when the
+ *       buffer is refilled, except from the start of objects whose members have been read out of order onward
+ */
+template <typename IStreamT, json_packet_format PacketFormat>
+class json_iarchive : public iarchive<json_iarchive<IStreamT, PacketFormat>>
 {
-  using iarchive_base = iarchive<json_iarchive<IStreamT>>;
+  using iarchive_base = iarchive<json_iarchive<IStreamT, PacketFormat>>;
 
   friend iarchive_base;
 
 public:
+  /// Maximum number of bytes requested from the stream at once
+  static constexpr std::size_t read_block_size = 64UL * 1024UL;
+
   explicit json_iarchive(istream<IStreamT>& is) : is_{static_cast<IStreamT*>(std::addressof(is))}
   {
-    json_iarchive::eat<'{'>();
+    json_iarchive::begin_object();
   }
 
-  ~json_iarchive() { json_iarchive::eat<'}'>(); }
+  ~json_iarchive() = default;
 
   template <typename ValueT> constexpr json_iarchive& operator>>(ValueT& v)
   {
-    load_json_primitive<ValueT>{}(*this, v);
+    if constexpr (is_packet_v<ValueT>)
+    {
+      iarchive_base::operator>>(v);
+    }
+    else
+    {
+      load_json_primitive<ValueT>{}(*this, v);
+    }
     return *this;
   }
 
@@ -72,37 +102,290 @@ public:
   using iarchive_base::operator&;
 
 private:
-  template <char TargetChar> void eat()
+  /**
+   * @brief Reads the next block of the stream into the buffer
+   *
+   * @return false if the stream has no more data
+   */
+  bool fill()
   {
-    while (true)
+    const std::size_t len = std::min(is_->available(), read_block_size);
+    if (len == 0)
     {
-      if (is_->available() == 0)
+      return false;
+    }
+    json_iarchive::compact();
+    const std::size_t prev_size = buffer_.size();
+    buffer_.resize(prev_size + len);
+    buffer_.resize(prev_size + is_->read(buffer_.data() + prev_size, len));
+    return buffer_.size() > prev_size;
+  }
+
+  /**
+   * @brief Drops buffered bytes which will not be read again
+   *
+   *        Objects whose members have all been read in order only ever search forward from the cursor, so only objects
+   *        which were searched from their start keep those bytes. Bytes are only dropped once they make up at least
+   *        half of the buffer, so that retained bytes are moved a bounded number of times.
+   */
+  void compact()
+  {
+    std::size_t keep_from = std::min(pos_, token_begin_);
+    for (const auto& object : open_objects_)
+    {
+      if (!object.in_order)
       {
-        throw std::runtime_error{"JSON is ill-formed"};
+        keep_from = std::min(keep_from, object.begin);
       }
+    }
 
-      const bool keep_eating = is_->peek() != TargetChar;
+    if (keep_from == 0 or keep_from < buffer_.size() / 2)
+    {
+      return;
+    }
 
-      char eatchar;
-      is_->read(reinterpret_cast<void*>(&eatchar), 1);
+    buffer_.erase(buffer_.begin(), buffer_.begin() + keep_from);
+    pos_ -= keep_from;
+    if (token_begin_ != npos)
+    {
+      token_begin_ -= keep_from;
+    }
+    for (auto& object : open_objects_)
+    {
+      // Starts of objects read in order are reset to the cursor before they are used again
+      object.begin = (object.begin > keep_from) ? (object.begin - keep_from) : 0;
+    }
+  }
 
-      if (!keep_eating)
+  /**
+   * @brief Ensures that at least \c len bytes past the cursor are buffered
+   */
+  bool ensure(const std::size_t len)
+  {
+    while (pos_ + len > buffer_.size())
+    {
+      if (!json_iarchive::fill())
       {
-        break;
+        return false;
       }
     }
+    return true;
   }
 
-  constexpr void read_impl(label& l)
+  char peek_char()
   {
+    if (!json_iarchive::ensure(1))
+    {
+      throw std::runtime_error{"JSON is ill-formed. Unexpected end of stream."};
+    }
+    return buffer_[pos_];
+  }
+
+  char next_char()
+  {
+    const char c = json_iarchive::peek_char();
+    ++pos_;
+    return c;
+  }
+
+  static constexpr bool is_whitespace(const char c) { return c == ' ' or c == '\n' or c == '\r' or c == '\t'; }
+
+  static constexpr bool is_numeric(const char c)
+  {
+    return (c >= '0' and c <= '9') or c == '-' or c == '+' or c == '.' or c == 'e' or c == 'E';
+  }
+
+  void skip_whitespace()
+  {
+    do
+    {
+      while (pos_ < buffer_.size() and is_whitespace(buffer_[pos_]))
+      {
+        ++pos_;
+      }
+    } while (pos_ == buffer_.size() and json_iarchive::fill());
+  }
+
+  template <char TargetChar> void eat()
+  {
+    json_iarchive::skip_whitespace();
+    if (json_iarchive::next_char() != TargetChar)
+    {
+      throw std::runtime_error{"JSON is ill-formed. Unexpected character."};
+    }
+  }
+
+  void begin_object()
+  {
+    json_iarchive::eat<'{'>();
+    open_objects_.push_back({pos_, true});
+  }
+
+  void end_object()
+  {
+    // Skip any members which were not read
+    for (std::size_t key_pos, key_len; json_iarchive::next_key(key_pos, key_len);)
+    {
+      json_iarchive::skip_value();
+    }
+    json_iarchive::eat<'}'>();
+    open_objects_.pop_back();
+  }
+
+  /**
+   * @brief Reads the next member key of the current object, up to and including the ':' which follows it
+   *
+   * @return false if there are no more members in the current object
+   */
+  bool next_key(std::size_t& key_pos, std::size_t& key_len)
+  {
+    json_iarchive::skip_whitespace();
+    if (json_iarchive::peek_char() == ',')
+    {
+      ++pos_;
+      json_iarchive::skip_whitespace();
+    }
+
+    if (json_iarchive::peek_char() == '}')
+    {
+      return false;
+    }
+
     json_iarchive::eat<'"'>();
-    json_iarchive::eat<'"'>();
+    token_begin_ = pos_;
+    json_iarchive::skip_string_body();
+    key_len = pos_ - token_begin_ - 1;
     json_iarchive::eat<':'>();
+    key_pos = std::exchange(token_begin_, npos);
+    return true;
   }
 
-  template <typename IteratorT> constexpr void read_impl(sequence<IteratorT>& sequence)
+  bool key_equals(const std::size_t key_pos, const std::size_t key_len, const std::string_view key) const
   {
+    return std::string_view{buffer_.data() + key_pos, key_len} == key;
+  }
 
+  /**
+   * @brief Moves past the remainder of a string, up to and including its closing quote
+   */
+  void skip_string_body()
+  {
+    while (true)
+    {
+      const char* const first = buffer_.data() + pos_;
+      const char* const last = buffer_.data() + buffer_.size();
+      const char* const quote = static_cast<const char*>(std::memchr(first, '"', last - first));
+      if (quote == nullptr)
+      {
+        // Keep trailing backslashes, which escape a quote at the start of the next block
+        pos_ = buffer_.size();
+        while (pos_ > 0 and buffer_[pos_ - 1] == '\\')
+        {
+          --pos_;
+        }
+        if (!json_iarchive::fill())
+        {
+          throw std::runtime_error{"JSON is ill-formed. Unterminated string."};
+        }
+        continue;
+      }
+
+      // Quote is escaped if preceded by an odd number of backslashes
+      std::size_t backslash_count = 0;
+      for (const char* c = quote; c != buffer_.data() and *(c - 1) == '\\'; --c)
+      {
+        ++backslash_count;
+      }
+      pos_ = static_cast<std::size_t>(quote - buffer_.data()) + 1;
+      if ((backslash_count & 1) == 0)
+      {
+        return;
+      }
+    }
+  }
+
+  void skip_value()
+  {
+    json_iarchive::skip_whitespace();
+    switch (json_iarchive::peek_char())
+    {
+    case '{': {
+      ++pos_;
+      for (std::size_t key_pos, key_len; json_iarchive::next_key(key_pos, key_len);)
+      {
+        json_iarchive::skip_value();
+      }
+      json_iarchive::eat<'}'>();
+      break;
+    }
+    case '[': {
+      ++pos_;
+      json_iarchive::skip_whitespace();
+      if (json_iarchive::peek_char() != ']')
+      {
+        do
+        {
+          json_iarchive::skip_value();
+          json_iarchive::skip_whitespace();
+        } while (json_iarchive::peek_char() == ',' and ++pos_);
+      }
+      json_iarchive::eat<']'>();
+      break;
+    }
+    case '"': {
+      ++pos_;
+      json_iarchive::skip_string_body();
+      break;
+    }
+    default: {
+      // Scalar token (number, boolean or null)
+      while (json_iarchive::ensure(1))
+      {
+        if (const char c = buffer_[pos_]; c == ',' or c == '}' or c == ']' or is_whitespace(c))
+        {
+          break;
+        }
+        ++pos_;
+      }
+      break;
+    }
+    }
+  }
+
+  constexpr void read_impl(label& l)
+  {
+    std::size_t key_pos, key_len;
+
+    // While members are read in the order they were written, all members before the cursor have been read
+    auto& object = open_objects_.back();
+    if (object.in_order)
+    {
+      object.begin = pos_;
+    }
+
+    // Members are usually read in the order they were written
+    if (json_iarchive::next_key(key_pos, key_len) and json_iarchive::key_equals(key_pos, key_len, l.value))
+    {
+      return;
+    }
+
+    // Otherwise, search all members of the current object which have not been read in order
+    object.in_order = false;
+    pos_ = object.begin;
+    while (json_iarchive::next_key(key_pos, key_len))
+    {
+      if (json_iarchive::key_equals(key_pos, key_len, l.value))
+      {
+        return;
+      }
+      json_iarchive::skip_value();
+    }
+
+    throw std::runtime_error{"JSON is missing expected key: " + std::string{l.value}};
+  }
+
+  template <typename IteratorT> constexpr void read_impl(sequence<IteratorT>& sequence)
+  {
     json_iarchive::eat<'['>();
     const auto [first, last] = sequence;
 
@@ -122,80 +405,271 @@ private:
     json_iarchive::eat<']'>();
   }
 
-  template <typename ValueT> friend struct load_json_primitive;
-  friend struct load_json_numeric;
+  template <typename PointerT> constexpr void read_impl(basic_packet<PointerT>& packet)
+  {
+    using value_type = std::remove_pointer_t<PointerT>;
+    if constexpr (std::is_void_v<value_type>)
+    {
+      json_iarchive::read_base64(packet.data, packet.len);
+    }
+    else
+    {
+      json_iarchive::read_base64(packet.data, packet.len * sizeof(value_type));
+    }
+  }
 
-  IStreamT* is_;
-};
+  template <typename PointerT, std::size_t Len>
+  constexpr void read_impl(basic_packet_fixed_size<PointerT, Len>& packet)
+  {
+    using value_type = std::remove_pointer_t<PointerT>;
+    if constexpr (std::is_void_v<value_type>)
+    {
+      json_iarchive::read_base64(packet.data, packet.len);
+    }
+    else
+    {
+      json_iarchive::read_base64(packet.data, packet.len * sizeof(value_type));
+    }
+  }
 
-template <typename IStreamT> json_iarchive(istream<IStreamT>& os) -> json_iarchive<IStreamT>;
+  void read_base64(void* data, const std::size_t len)
+  {
+    json_iarchive::eat<'"'>();
+    token_begin_ = pos_;
+    json_iarchive::skip_string_body();
 
-template <typename IStreamT, typename ValueT>
-struct load_impl<json_iarchive<IStreamT>, ValueT> : std::conditional_t<
-                                                      /* if( cond  ) */ is_named_v<ValueT>,
-                                                      /* ->( true  ) */ load<json_iarchive<IStreamT>, ValueT>,
-                                                      /* ->( false ) */ load_json_primitive<ValueT>>
-{};
+    const char* const first = buffer_.data() + std::exchange(token_begin_, npos);
+    const char* const last = buffer_.data() + pos_ - 1;
+    if (!base64_decode(data, len, first, last))
+    {
+      throw std::runtime_error{"JSON is ill-formed. Error while reading base64 packet."};
+    }
+  }
 
-/**
- * @brief JSON input archive <code>float</code> save implementation
- */
-struct load_json_numeric
-{
-  template <typename JSONArchiveT, typename NumericT> void operator()(JSONArchiveT& ar, NumericT& v)
+  template <typename NumericT> void read_numeric(NumericT& v)
+  {
+    json_iarchive::skip_whitespace();
+
+    token_begin_ = pos_;
+    while (json_iarchive::ensure(1) and is_numeric(buffer_[pos_]))
+    {
+      ++pos_;
+    }
+
+    const char* const first = buffer_.data() + std::exchange(token_begin_, npos);
+    const char* const last = buffer_.data() + pos_;
+
+    if constexpr (std::is_integral_v<NumericT>)
+    {
+      // JSON numbers may carry an explicit leading '+', which from_chars does not accept
+      const char* const digits = (first != last and *first == '+') ? (first + 1) : first;
+      if (const auto [ptr, ec] = std::from_chars(digits, last, v); ec == std::errc{} and ptr == last)
+      {
+        return;
+      }
+    }
+#if defined(__cpp_lib_to_chars)
+    else if (const auto [ptr, ec] = std::from_chars(first, last, v); ec == std::errc{} and ptr == last)
+    {
+      return;
+    }
+#else
+    else if (char token[64]; static_cast<std::size_t>(last - first) < sizeof(token))
+    {
+      std::memcpy(token, first, last - first);
+      token[last - first] = '\0';
+      char* token_end = nullptr;
+      v = static_cast<NumericT>(std::strtod(token, &token_end));
+      if (token_end == token + (last - first))
+      {
+        return;
+      }
+    }
+#endif  // defined(__cpp_lib_to_chars)
+
+    throw std::runtime_error{"JSON is ill-formed. Error while reading numeric type."};
+  }
+
+  void read_bool(bool& v)
   {
-    std::stringstream ss;
+    json_iarchive::skip_whitespace();
+    const auto matches = [this](const std::string_view token) {
+      if (!json_iarchive::ensure(token.size()))
+      {
+        return false;
+      }
+      for (std::size_t i = 0; i < token.size(); ++i)
+      {
+        // Accept 'True'/'False' written by older versions of json_oarchive
+        if ((buffer_[pos_ + i] | 0x20) != token[i])
+        {
+          return false;
+        }
+      }
+      pos_ += token.size();
+      return true;
+    };
+
+    if (matches("true"))
+    {
+      v = true;
+    }
+    else if (matches("false"))
+    {
+      v = false;
+    }
+    else
+    {
+      throw std::runtime_error{"JSON is ill-formed. Error while reading bool type."};
+    }
+  }
+
+  void read_string(std::string& v)
+  {
+    json_iarchive::eat<'"'>();
+    v.clear();
     while (true)
     {
-      if (ar.is_->available() == 0)
+      const char c = json_iarchive::next_char();
+      if (c == '"')
       {
-        throw std::runtime_error{"JSON is ill-formed. Error while reading numeric type."};
+        return;
       }
-      else if (const char pc = ar.is_->peek(); std::isspace(pc))
+      else if (c != '\\')
       {
-        char digit;
-        ar.is_->read(reinterpret_cast<void*>(&digit), 1);
+        // Copy runs of unescaped characters at once
+        const std::size_t run_pos = pos_ - 1;
+        while (pos_ < buffer_.size() and buffer_[pos_] != '"' and buffer_[pos_] != '\\')
+        {
+          ++pos_;
+        }
+        v.append(buffer_.data() + run_pos, pos_ - run_pos);
         continue;
       }
-      else if (std::isdigit(pc) or pc == '.')
+
+      switch (const char escaped = json_iarchive::next_char(); escaped)
       {
-        char digit;
-        ar.is_->read(reinterpret_cast<void*>(&digit), 1);
-        ss << digit;
+      case 'n':
+        v.push_back('\n');
+        break;
+      case 't':
+        v.push_back('\t');
+        break;
+      case 'r':
+        v.push_back('\r');
+        break;
+      case 'b':
+        v.push_back('\b');
+        break;
+      case 'f':
+        v.push_back('\f');
+        break;
+      case 'u': {
+        if (!json_iarchive::ensure(4))
+        {
+          throw std::runtime_error{"JSON is ill-formed. Error while reading string type."};
+        }
+        unsigned code = 0;
+        if (const auto [ptr, ec] = std::from_chars(buffer_.data() + pos_, buffer_.data() + pos_ + 4, code, 16);
+            ec != std::errc{} or ptr != buffer_.data() + pos_ + 4)
+        {
+          throw std::runtime_error{"JSON is ill-formed. Error while reading string type."};
+        }
+        pos_ += 4;
+        json_iarchive::append_utf8(v, code);
+        break;
       }
-      else
-      {
+      default:
+        v.push_back(escaped);
         break;
       }
     }
-    ss >> v;
   }
-};
 
-/**
- * @brief JSON output archive <code>bool</code> save implementation
- */
-template <> struct load_json_primitive<bool>
-{
-  template <typename JSONArchiveT> void operator()(JSONArchiveT& ar, bool& v)
+  static void append_utf8(std::string& v, const unsigned code)
   {
-    if (ar.is_->peek() == 'T')
+    if (code < 0x80)
     {
-      static char buf[4];
-      ar.is_->read(buf, sizeof(buf));
-      v = true;
+      v.push_back(static_cast<char>(code));
     }
-    else if (ar.is_->peek() == 'F')
+    else if (code < 0x800)
     {
-      static char buf[5];
-      ar.is_->read(buf, sizeof(buf));
-      v = false;
+      v.push_back(static_cast<char>(0xC0 | (code >> 6)));
+      v.push_back(static_cast<char>(0x80 | (code & 0x3F)));
     }
     else
     {
-      throw std::runtime_error{"JSON is ill-formed. Error while reading bool type."};
+      v.push_back(static_cast<char>(0xE0 | (code >> 12)));
+      v.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+      v.push_back(static_cast<char>(0x80 | (code & 0x3F)));
     }
   }
+
+  void read_raw(void* ptr)
+  {
+    *reinterpret_cast<char*>(ptr) = json_iarchive::next_char();
+  }
+
+  template <typename ValueT> friend struct load_json_primitive;
+  friend struct load_json_numeric;
+
+  /// Stream from which JSON is read
+  IStreamT* is_;
+
+  /// Marks buffer positions which are unset
+  static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+  /**
+   * @brief Object which is currently being read
+   */
+  struct open_object
+  {
+    /// Buffer position from which members are searched
+    std::size_t begin;
+    /// Indicates that all members have so far been read in the order they were written
+    bool in_order;
+  };
+
+  /// JSON read from stream, from the earliest position which may still be read
+  std::vector<char> buffer_;
+
+  /// Read position within buffer_
+  std::size_t pos_ = 0;
+
+  /// Buffer position of the start of the token being read, which is retained while the buffer is refilled
+  std::size_t token_begin_ = npos;
+
+  /// Objects currently being read, from outermost to innermost
+  std::vector<open_object> open_objects_;
+};
+
+template <typename IStreamT> json_iarchive(istream<IStreamT>& os) -> json_iarchive<IStreamT>;
+
+template <typename IStreamT, json_packet_format PacketFormat, typename ValueT>
+struct load_impl<json_iarchive<IStreamT, PacketFormat>, ValueT>
+    : std::conditional_t<
+        /* if( cond  ) */ is_named_v<ValueT>,
+        /* ->( true  ) */ load<json_iarchive<IStreamT, PacketFormat>, ValueT>,
+        /* ->( false ) */ load_json_primitive<ValueT>>
+{};
+
+/**
+ * @brief JSON input archive numeric load implementation
+ */
+struct load_json_numeric
+{
+  template <typename JSONArchiveT, typename NumericT> void operator()(JSONArchiveT& ar, NumericT& v)
+  {
+    ar.read_numeric(v);
+  }
+};
+
+/**
+ * @brief JSON input archive <code>bool</code> load implementation
+ */
+template <> struct load_json_primitive<bool>
+{
+  template <typename JSONArchiveT> void operator()(JSONArchiveT& ar, bool& v) { ar.read_bool(v); }
 };
 
 /**
@@ -235,52 +709,51 @@ template <> struct load_json_primitive<long unsigned int> : load_json_numeric
 {};
 
 /**
- * @brief JSON input archive <code>unsigned char</code> save implementation
+ * @brief JSON input archive <code>long long int</code> load implementation
+ */
+template <> struct load_json_primitive<long long int> : load_json_numeric
+{};
+
+/**
+ * @brief JSON input archive <code>long long unsigned int</code> load implementation
+ */
+template <> struct load_json_primitive<long long unsigned int> : load_json_numeric
+{};
+
+/**
+ * @brief JSON input archive <code>unsigned char</code> load implementation
  */
 template <> struct load_json_primitive<unsigned char>
 {
-  template <typename JSONArchiveT> void operator()(JSONArchiveT& ar, unsigned char& v)
-  {
-    ar.is_->read(reinterpret_cast<void*>(&v), 1);
-  }
+  template <typename JSONArchiveT> void operator()(JSONArchiveT& ar, unsigned char& v) { ar.read_raw(&v); }
 };
 
 /**
- * @brief JSON input archive <code>unsigned char</code> save implementation
+ * @brief JSON input archive <code>char</code> load implementation
  */
 template <> struct load_json_primitive<char>
 {
-  template <typename JSONArchiveT> void operator()(JSONArchiveT& ar, char& v)
-  {
-    ar.is_->read(reinterpret_cast<void*>(&v), 1);
-  }
+  template <typename JSONArchiveT> void operator()(JSONArchiveT& ar, char& v) { ar.read_raw(&v); }
 };
 
 /**
- * @brief JSON input archive <code>std::string</code> save implementation
+ * @brief JSON input archive <code>std::string</code> load implementation
  */
 template <> struct load_json_primitive<std::string>
 {
-  template <typename JSONArchiveT> void operator()(JSONArchiveT& ar, std::string& v)
-  {
-    ar.template eat<'"'>();
-    while (ar.is_->peek() != '"')
-    {
-      if (ar.is_->available() == 0)
-      {
-        throw std::runtime_error{"JSON is ill-formed. Error while reading string type."};
-      }
-      char character;
-      ar.is_->read(reinterpret_cast<void*>(&character), 1);
-      v.push_back(character);
-    }
-    ar.template eat<'"'>();
-  }
+  template <typename JSONArchiveT> void operator()(JSONArchiveT& ar, std::string& v) { ar.read_string(v); }
 };
 
-// Force element/field-wise serialization
-template <typename IStreamT, typename ValueT>
-struct is_trivially_serializable<json_iarchive<IStreamT>, ValueT> : std::false_type
+/**
+ * @brief Deserializes trivially serializable data as packets only when the archive reads packets as base64
+ */
+template <typename IStreamT, json_packet_format PacketFormat, typename ValueT>
+struct is_trivially_serializable<json_iarchive<IStreamT, PacketFormat>, ValueT>
+    : std::bool_constant<PacketFormat == json_packet_format::base64 and std::is_trivial_v<ValueT>>
+{};
+
+template <typename IStreamT, json_packet_format PacketFormat>
+struct archive_uses_labels<json_iarchive<IStreamT, PacketFormat>> : std::true_type
 {};
 
 }  // namespace tyl::serialization
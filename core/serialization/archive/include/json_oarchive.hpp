@@ -6,12 +6,20 @@
 #pragma once
 
 // C++ Standard Library
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <exception>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 // Tyl
+#include <tyl/serialization/archive_fwd.hpp>
+#include <tyl/serialization/base64.hpp>
 #include <tyl/serialization/named.hpp>
 #include <tyl/serialization/oarchive.hpp>
 #include <tyl/serialization/object.hpp>
@@ -19,6 +27,19 @@
 
 namespace tyl::serialization
 {
+namespace detail
+{
+
+/**
+ * @brief Returns staging buffers released by JSON output archives on the calling thread, for reuse
+ */
+inline std::vector<std::vector<char>>& json_staging_buffer_pool()
+{
+  static thread_local std::vector<std::vector<char>> pool;
+  return pool;
+}
+
+}  // namespace detail
 
 template <typename ValueT> struct save_json_primitive
 {
@@ -33,32 +54,88 @@ template <typename ValueT> struct save_json_primitive
     }
     else
     {
-      ar.os_->write("{", 1);
+      ar.put('{');
       save<JSONArchiveT, ValueT>{}(ar, object);
-      ar.os_->write("}", 1);
+      ar.put('}');
     }
     ar.skip_next_comma_ = false;
   }
 };
 
-template <typename OStreamT> class json_oarchive : public oarchive<json_oarchive<OStreamT>>
+/**
+ * @brief JSON output archive
+ *
+ *        Output is formatted into a staging buffer, which is written to the stream in large blocks. Staging buffers
+ *        are recycled between archives created on the same thread.
+ *
+ * @tparam PacketFormat  selects whether trivially serializable data is written field-wise, or as base64 packets
+ */
+template <typename OStreamT, json_packet_format PacketFormat>
+class json_oarchive : public oarchive<json_oarchive<OStreamT, PacketFormat>>
 {
-  using oarchive_base = oarchive<json_oarchive<OStreamT>>;
+  using oarchive_base = oarchive<json_oarchive<OStreamT, PacketFormat>>;
 
   friend oarchive_base;
 
 public:
+  /// Number of staged bytes at which staged output is written to the stream
+  static constexpr std::size_t flush_threshold = 64UL * 1024UL;
+
   explicit json_oarchive(ostream<OStreamT>& os) :
-      os_{static_cast<OStreamT*>(std::addressof(os))}, skip_next_comma_{true}
+      os_{static_cast<OStreamT*>(std::addressof(os))}, buffer_{acquire_buffer()}, skip_next_comma_{true}
+  {
+    json_oarchive::put('{');
+  }
+
+  /**
+   * @brief Closes the top-level object and writes all staged output to the stream
+   *
+   * @note destructors must not throw (e.g. while unwinding), so stream errors are reported on stderr instead; call
+   *       \c flush first to handle them
+   */
+  ~json_oarchive()
   {
-    os_->write("{", 1);
+    try
+    {
+      json_oarchive::put("}\n");
+      json_oarchive::flush();
+      buffer_.clear();
+      detail::json_staging_buffer_pool().push_back(std::move(buffer_));
+    }
+    catch (const std::exception& ex)
+    {
+      std::fprintf(stderr, "[ERROR] json_oarchive: failed to write staged output: %s\n", ex.what());
+    }
+    catch (...)
+    {
+      std::fprintf(stderr, "%s\n", "[ERROR] json_oarchive: failed to write staged output");
+    }
   }
 
-  ~json_oarchive() { os_->write("}\n", 2); }
+  /**
+   * @brief Writes all staged output to the stream
+   *
+   * @throws any exception thrown by the stream, with staged output left in place
+   */
+  void flush()
+  {
+    if (!buffer_.empty())
+    {
+      os_->write(buffer_.data(), buffer_.size());
+      buffer_.clear();
+    }
+  }
 
   template <typename ValueT> constexpr json_oarchive& operator<<(const ValueT& v)
   {
-    save_json_primitive<ValueT>{}(*this, v);
+    if constexpr (is_packet_v<ValueT>)
+    {
+      oarchive_base::operator<<(v);
+    }
+    else
+    {
+      save_json_primitive<ValueT>{}(*this, v);
+    }
     return *this;
   }
 
@@ -85,6 +162,131 @@ public:
 private:
   using oarchive_base::operator<<;
 
+  static std::vector<char> acquire_buffer()
+  {
+    auto& pool = detail::json_staging_buffer_pool();
+    if (pool.empty())
+    {
+      std::vector<char> buffer;
+      buffer.reserve(flush_threshold);
+      return buffer;
+    }
+    auto buffer = std::move(pool.back());
+    pool.pop_back();
+    return buffer;
+  }
+
+  void put(const char c)
+  {
+    buffer_.push_back(c);
+    if (buffer_.size() >= flush_threshold)
+    {
+      json_oarchive::flush();
+    }
+  }
+
+  void put(const std::string_view str)
+  {
+    buffer_.insert(buffer_.end(), str.begin(), str.end());
+    if (buffer_.size() >= flush_threshold)
+    {
+      json_oarchive::flush();
+    }
+  }
+
+  template <typename NumericT> void put_numeric(const NumericT v)
+  {
+    char str[32];
+    if constexpr (std::is_integral_v<NumericT>)
+    {
+      const auto [ptr, ec] = std::to_chars(str, str + sizeof(str), v);
+      json_oarchive::put(std::string_view{str, static_cast<std::size_t>(ptr - str)});
+    }
+    else
+    {
+#if defined(__cpp_lib_to_chars)
+      // Shortest representation which reads back to the same value
+      const auto [ptr, ec] = std::to_chars(str, str + sizeof(str), v);
+      json_oarchive::put(std::string_view{str, static_cast<std::size_t>(ptr - str)});
+#else
+      const int len = std::snprintf(str, sizeof(str), "%.*g", std::is_same_v<NumericT, float> ? 9 : 17, v);
+      json_oarchive::put(std::string_view{str, static_cast<std::size_t>(len)});
+#endif  // defined(__cpp_lib_to_chars)
+    }
+  }
+
+  void put_string(const std::string_view str)
+  {
+    json_oarchive::put('"');
+    std::size_t run_first = 0;
+    for (std::size_t i = 0; i < str.size(); ++i)
+    {
+      const char c = str[i];
+      if (c != '"' and c != '\\' and static_cast<unsigned char>(c) >= 0x20)
+      {
+        continue;
+      }
+
+      // Write run of characters which need no escaping at once
+      json_oarchive::put(str.substr(run_first, i - run_first));
+      run_first = i + 1;
+
+      switch (c)
+      {
+      case '"':
+        json_oarchive::put("\\\"");
+        break;
+      case '\\':
+        json_oarchive::put("\\\\");
+        break;
+      case '\n':
+        json_oarchive::put("\\n");
+        break;
+      case '\t':
+        json_oarchive::put("\\t");
+        break;
+      case '\r':
+        json_oarchive::put("\\r");
+        break;
+      case '\b':
+        json_oarchive::put("\\b");
+        break;
+      case '\f':
+        json_oarchive::put("\\f");
+        break;
+      default: {
+        static constexpr char hex[] = "0123456789abcdef";
+        const char escaped[] = {'\\', 'u', '0', '0', hex[(c >> 4) & 0xF], hex[c & 0xF]};
+        json_oarchive::put(std::string_view{escaped, sizeof(escaped)});
+        break;
+      }
+      }
+    }
+    json_oarchive::put(str.substr(run_first));
+    json_oarchive::put('"');
+  }
+
+  void put_base64(const void* data, const std::size_t len)
+  {
+    // Encode in chunks, so that large packets are flushed in blocks rather than staged all at once
+    static constexpr std::size_t chunk_size = (flush_threshold / 4) * 3;
+
+    json_oarchive::put('"');
+    const auto* const bytes = static_cast<const char*>(data);
+    for (std::size_t offset = 0; offset < len; offset += chunk_size)
+    {
+      const std::size_t chunk_len = std::min(chunk_size, len - offset);
+      const std::size_t prev_size = buffer_.size();
+      buffer_.resize(prev_size + base64_encoded_size(chunk_len));
+      base64_encode(buffer_.data() + prev_size, bytes + offset, chunk_len);
+      if (buffer_.size() >= flush_threshold)
+      {
+        json_oarchive::flush();
+      }
+    }
+    json_oarchive::put('"');
+  }
+
   void update()
   {
     if (skip_next_comma_)
@@ -93,15 +295,15 @@ private:
     }
     else
     {
-      os_->write(",", 1);
+      json_oarchive::put(',');
     }
   }
 
   constexpr void write_impl(const label& l)
   {
-    os_->write("\"", 1);
-    os_->write(l.value.data(), l.value.size());
-    os_->write("\":", 2);
+    json_oarchive::put('"');
+    json_oarchive::put(l.value);
+    json_oarchive::put("\":");
   }
 
   template <typename PointerT> constexpr void write_impl(const basic_packet<PointerT>& packet)
@@ -109,154 +311,148 @@ private:
     using value_type = std::remove_pointer_t<PointerT>;
     if constexpr (std::is_void_v<value_type>)
     {
-      (*this) << std::string_view{reinterpret_cast<const char*>(packet.data), packet.len};
+      json_oarchive::put_base64(packet.data, packet.len);
+    }
+    else
+    {
+      json_oarchive::put_base64(packet.data, packet.len * sizeof(value_type));
+    }
+  }
+
+  template <typename PointerT, std::size_t Len>
+  constexpr void write_impl(const basic_packet_fixed_size<PointerT, Len>& packet)
+  {
+    using value_type = std::remove_pointer_t<PointerT>;
+    if constexpr (std::is_void_v<value_type>)
+    {
+      json_oarchive::put_base64(packet.data, packet.len);
     }
     else
     {
-      (*this) << std::string_view{reinterpret_cast<const char*>(packet.data), packet.len * sizeof(value_type)};
+      json_oarchive::put_base64(packet.data, packet.len * sizeof(value_type));
     }
   }
 
   template <typename IteratorT> constexpr void write_impl(const sequence<IteratorT>& sequence)
   {
     skip_next_comma_ = true;
-    os_->write("[", 1);
+    json_oarchive::put('[');
     const auto [first, last] = sequence;
     for (auto itr = first; itr != last; ++itr)
     {
       json_oarchive::update();
       (*this) << (*itr);
     }
-    os_->write("]", 1);
+    json_oarchive::put(']');
   }
 
   template <typename ValueT> friend struct save_json_primitive;
+  friend struct save_json_numeric;
 
+  /// Stream to which staged output is written
   OStreamT* os_;
+
+  /// Output which has not yet been written to the stream
+  std::vector<char> buffer_;
+
+  /// Set when the next label or sequence element is the first in its enclosing object or array
   bool skip_next_comma_;
 };
 
 template <typename OStreamT> json_oarchive(ostream<OStreamT>& os) -> json_oarchive<OStreamT>;
 
 
-template <typename OStreamT, typename ValueT>
-struct save_impl<json_oarchive<OStreamT>, ValueT> : std::conditional_t<
-                                                      /* if( cond  ) */ is_named_v<ValueT>,
-                                                      /* ->( true  ) */ save<json_oarchive<OStreamT>, ValueT>,
-                                                      /* ->( false ) */ save_json_primitive<ValueT>>
+template <typename OStreamT, json_packet_format PacketFormat, typename ValueT>
+struct save_impl<json_oarchive<OStreamT, PacketFormat>, ValueT>
+    : std::conditional_t<
+        /* if( cond  ) */ is_named_v<ValueT>,
+        /* ->( true  ) */ save<json_oarchive<OStreamT, PacketFormat>, ValueT>,
+        /* ->( false ) */ save_json_primitive<ValueT>>
 {};
 
 /**
- * @brief JSON output archive <code>double</code> save implementation
+ * @brief JSON output archive numeric save implementation
  */
-template <> struct save_json_primitive<bool>
+struct save_json_numeric
 {
-  template <typename JSONArchiveT> void operator()(JSONArchiveT& ar, bool v)
+  template <typename JSONArchiveT, typename NumericT> void operator()(JSONArchiveT& ar, const NumericT v)
   {
-    if (v)
-    {
-      static constexpr std::string_view str{"True"};
-      ar.os_->write(str.data(), str.size());
-    }
-    else
-    {
-      static constexpr std::string_view str{"False"};
-      ar.os_->write(str.data(), str.size());
-    }
+    ar.put_numeric(v);
   }
 };
 
 /**
- * @brief JSON output archive <code>double</code> save implementation
+ * @brief JSON output archive <code>bool</code> save implementation
  */
-template <> struct save_json_primitive<double>
+template <> struct save_json_primitive<bool>
 {
-  template <typename JSONArchiveT> void operator()(JSONArchiveT& ar, double v)
-  {
-    auto str = std::to_string(v);
-    ar.os_->write(str.data(), str.size());
-  }
+  template <typename JSONArchiveT> void operator()(JSONArchiveT& ar, bool v) { ar.put(v ? "true" : "false"); }
 };
 
+/**
+ * @brief JSON output archive <code>double</code> save implementation
+ */
+template <> struct save_json_primitive<double> : save_json_numeric
+{};
+
 /**
  * @brief JSON output archive <code>float</code> save implementation
  */
-template <> struct save_json_primitive<float>
-{
-  template <typename JSONArchiveT> void operator()(JSONArchiveT& ar, float v)
-  {
-    auto str = std::to_string(v);
-    ar.os_->write(str.data(), str.size());
-  }
-};
+template <> struct save_json_primitive<float> : save_json_numeric
+{};
 
 /**
  * @brief JSON output archive <code>int</code> save implementation
  */
-template <> struct save_json_primitive<int>
-{
-  template <typename JSONArchiveT> void operator()(JSONArchiveT& ar, int v)
-  {
-    auto str = std::to_string(v);
-    ar.os_->write(str.data(), str.size());
-  }
-};
+template <> struct save_json_primitive<int> : save_json_numeric
+{};
 
 /**
- * @brief JSON output archive <code> longint</code> save implementation
+ * @brief JSON output archive <code>long int</code> save implementation
  */
-template <> struct save_json_primitive<long int>
-{
-  template <typename JSONArchiveT> void operator()(JSONArchiveT& ar, long int v)
-  {
-    auto str = std::to_string(v);
-    ar.os_->write(str.data(), str.size());
-  }
-};
+template <> struct save_json_primitive<long int> : save_json_numeric
+{};
 
 /**
- * @brief JSON output archive <code>int</code> save implementation
+ * @brief JSON output archive <code>unsigned int</code> save implementation
  */
-template <> struct save_json_primitive<unsigned int>
-{
-  template <typename JSONArchiveT> void operator()(JSONArchiveT& ar, unsigned int v)
-  {
-    auto str = std::to_string(v);
-    ar.os_->write(str.data(), str.size());
-  }
-};
+template <> struct save_json_primitive<unsigned int> : save_json_numeric
+{};
 
 /**
- * @brief JSON output archive <code>int</code> save implementation
+ * @brief JSON output archive <code>long unsigned int</code> save implementation
  */
-template <> struct save_json_primitive<long unsigned int>
-{
-  template <typename JSONArchiveT> void operator()(JSONArchiveT& ar, long unsigned int v)
-  {
-    auto str = std::to_string(v);
-    ar.os_->write(str.data(), str.size());
-  }
-};
+template <> struct save_json_primitive<long unsigned int> : save_json_numeric
+{};
 
 /**
- * @brief JSON output archive <code>int</code> save implementation
+ * @brief JSON output archive <code>long long int</code> save implementation
+ */
+template <> struct save_json_primitive<long long int> : save_json_numeric
+{};
+
+/**
+ * @brief JSON output archive <code>long long unsigned int</code> save implementation
+ */
+template <> struct save_json_primitive<long long unsigned int> : save_json_numeric
+{};
+
+/**
+ * @brief JSON output archive <code>char</code> save implementation
  */
 template <> struct save_json_primitive<char>
 {
-  template <typename JSONArchiveT> void operator()(JSONArchiveT& ar, char v)
-  {
-    ar.os_->write(reinterpret_cast<void*>(&v), 1);
-  }
+  template <typename JSONArchiveT> void operator()(JSONArchiveT& ar, char v) { ar.put(v); }
 };
 
 /**
- * @brief JSON output archive <code>int</code> save implementation
+ * @brief JSON output archive <code>unsigned char</code> save implementation
  */
 template <> struct save_json_primitive<unsigned char>
 {
   template <typename JSONArchiveT> void operator()(JSONArchiveT& ar, unsigned char v)
   {
-    ar.os_->write(reinterpret_cast<void*>(&v), 1);
+    ar.put(static_cast<char>(v));
   }
 };
 
@@ -267,9 +463,7 @@ template <> struct save_json_primitive<std::string_view>
 {
   template <typename JSONArchiveT> void operator()(JSONArchiveT& ar, const std::string_view& str)
   {
-    ar.os_->write("\"", 1);
-    ar.os_->write(str.data(), str.size());
-    ar.os_->write("\"", 1);
+    ar.put_string(str);
   }
 };
 
@@ -285,9 +479,16 @@ template <> struct save_json_primitive<std::string> : save_json_primitive<std::s
 template <> struct save_json_primitive<const char*> : save_json_primitive<std::string_view>
 {};
 
-// Force element/field-wise serialization
-template <typename OStreamT, typename ValueT>
-struct is_trivially_serializable<json_oarchive<OStreamT>, ValueT> : std::false_type
+/**
+ * @brief Serializes trivially serializable data as packets only when the archive writes packets as base64
+ */
+template <typename OStreamT, json_packet_format PacketFormat, typename ValueT>
+struct is_trivially_serializable<json_oarchive<OStreamT, PacketFormat>, ValueT>
+    : std::bool_constant<PacketFormat == json_packet_format::base64 and std::is_trivial_v<ValueT>>
+{};
+
+template <typename OStreamT, json_packet_format PacketFormat>
+struct archive_uses_labels<json_oarchive<OStreamT, PacketFormat>> : std::true_type
 {};
 
 }  // namespace tyl::serialization
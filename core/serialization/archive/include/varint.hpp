@@ -0,0 +1,135 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file varint.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstdint>
+#include <type_traits>
+
+namespace tyl::serialization
+{
+
+/**
+ * @brief Checks if a value is stored as a varint by compact archives
+ *
+ *        Applies to integers and enums wider than a byte; bools and single-byte values gain nothing from encoding.
+ */
+template <typename ValueT>
+static constexpr bool is_varint_encodable_v =
+  (std::is_integral_v<ValueT> or std::is_enum_v<ValueT>) and !std::is_same_v<ValueT, bool> and (sizeof(ValueT) > 1);
+
+/**
+ * @brief Checks whether an archive stores integers as varints, and sorted packets as varint differences
+ */
+template <typename ArchiveT> struct archive_uses_varints : std::false_type
+{};
+
+template <typename ArchiveT> constexpr bool archive_uses_varints_v = archive_uses_varints<ArchiveT>::value;
+
+/// Largest number of bytes needed to encode a 64-bit varint
+static constexpr std::size_t varint_max_size = 10;
+
+namespace detail
+{
+
+template <typename ValueT, bool IsEnum = std::is_enum_v<ValueT>> struct varint_integer
+{
+  using type = ValueT;
+};
+
+template <typename ValueT> struct varint_integer<ValueT, true>
+{
+  using type = std::underlying_type_t<ValueT>;
+};
+
+}  // namespace detail
+
+/**
+ * @brief Unsigned integer type with the same width as ValueT, used for varint encoding
+ */
+template <typename ValueT>
+using varint_unsigned_t = std::make_unsigned_t<typename detail::varint_integer<ValueT>::type>;
+
+/**
+ * @brief Maps a value to an unsigned integer; signed values are zigzag-encoded so that small magnitudes stay small
+ */
+template <typename ValueT> constexpr varint_unsigned_t<ValueT> zigzag_encode(const ValueT value)
+{
+  using integer_type = typename detail::varint_integer<ValueT>::type;
+  using unsigned_type = varint_unsigned_t<ValueT>;
+
+  const auto v = static_cast<integer_type>(value);
+  if constexpr (std::is_signed_v<integer_type>)
+  {
+    constexpr int sign_shift = static_cast<int>(sizeof(integer_type) * 8 - 1);
+    return static_cast<unsigned_type>(static_cast<unsigned_type>(v) << 1) ^
+      static_cast<unsigned_type>(v >> sign_shift);
+  }
+  else
+  {
+    return v;
+  }
+}
+
+/**
+ * @brief Inverse of zigzag_encode
+ */
+template <typename ValueT> constexpr ValueT zigzag_decode(const varint_unsigned_t<ValueT> u)
+{
+  using integer_type = typename detail::varint_integer<ValueT>::type;
+  using unsigned_type = varint_unsigned_t<ValueT>;
+
+  if constexpr (std::is_signed_v<integer_type>)
+  {
+    const auto v = static_cast<unsigned_type>((u >> 1) ^ static_cast<unsigned_type>(-(u & 1)));
+    return static_cast<ValueT>(static_cast<integer_type>(v));
+  }
+  else
+  {
+    return static_cast<ValueT>(u);
+  }
+}
+
+/**
+ * @brief Writes an unsigned integer as a LEB128 varint
+ *
+ * @return one past the last byte written; at most varint_max_size bytes are written
+ */
+template <typename UIntT> constexpr std::uint8_t* varint_encode(std::uint8_t* out, UIntT value)
+{
+  static_assert(std::is_unsigned_v<UIntT>);
+  while (value >= 0x80)
+  {
+    *out++ = static_cast<std::uint8_t>(value | 0x80);
+    value >>= 7;
+  }
+  *out++ = static_cast<std::uint8_t>(value);
+  return out;
+}
+
+/**
+ * @brief Reads a LEB128 varint into an unsigned integer
+ *
+ * @return one past the last byte read, or nullptr if bytes run out or the value overflows UIntT
+ */
+template <typename UIntT>
+constexpr const std::uint8_t* varint_decode(const std::uint8_t* first, const std::uint8_t* last, UIntT& value)
+{
+  static_assert(std::is_unsigned_v<UIntT>);
+  value = 0;
+  for (unsigned shift = 0; first != last and shift < sizeof(UIntT) * 8; shift += 7)
+  {
+    const std::uint8_t byte = *first++;
+    value |= static_cast<UIntT>(static_cast<UIntT>(byte & 0x7F) << shift);
+    if ((byte & 0x80) == 0)
+    {
+      return first;
+    }
+  }
+  return nullptr;
+}
+
+}  // namespace tyl::serialization
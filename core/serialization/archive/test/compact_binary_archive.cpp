@@ -0,0 +1,200 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file compact_binary_archive.cpp
+ */
+
+// C++ Standard Library
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Tyl
+#include <tyl/serialization/binary_archive.hpp>
+#include <tyl/serialization/compact_binary_archive.hpp>
+#include <tyl/serialization/mem_istream.hpp>
+#include <tyl/serialization/mem_ostream.hpp>
+#include <tyl/serialization/sorted_packet.hpp>
+#include <tyl/serialization/std/string.hpp>
+#include <tyl/serialization/std/vector.hpp>
+
+using namespace tyl::serialization;
+
+enum class SmallId : std::uint32_t
+{
+};
+
+struct TrivialStruct
+{
+  int x;
+  float y;
+};
+
+TEST(CompactBinaryArchive, VarintScalarsRoundTrip)
+{
+  const std::int64_t i64_values[] = {
+    0, 1, -1, 63, -64, 64, 1000000, std::numeric_limits<std::int64_t>::min(), std::numeric_limits<std::int64_t>::max()};
+
+  mem_ostream oms;
+  {
+    compact_binary_oarchive oar{oms};
+    for (const auto v : i64_values)
+    {
+      oar << v;
+    }
+    oar << std::numeric_limits<std::uint64_t>::max();
+    oar << static_cast<short>(-300);
+    oar << SmallId{42};
+    oar << TrivialStruct{-5, 2.5f};
+    oar << true;
+  }
+
+  mem_istream ims{std::move(oms)};
+  compact_binary_iarchive iar{ims};
+  for (const auto expected : i64_values)
+  {
+    std::int64_t v;
+    iar >> v;
+    ASSERT_EQ(v, expected);
+  }
+
+  std::uint64_t u64;
+  iar >> u64;
+  ASSERT_EQ(u64, std::numeric_limits<std::uint64_t>::max());
+
+  short s;
+  iar >> s;
+  ASSERT_EQ(s, -300);
+
+  SmallId id;
+  iar >> id;
+  ASSERT_EQ(id, SmallId{42});
+
+  TrivialStruct trivial;
+  iar >> trivial;
+  ASSERT_EQ(trivial.x, -5);
+  ASSERT_EQ(trivial.y, 2.5f);
+
+  bool b = false;
+  iar >> b;
+  ASSERT_TRUE(b);
+  ASSERT_EQ(ims.available(), 0UL);
+}
+
+TEST(CompactBinaryArchive, SmallValuesUseOneByte)
+{
+  mem_ostream oms;
+  {
+    compact_binary_oarchive oar{oms};
+    oar << std::size_t{5};
+    oar << -3;
+    oar << SmallId{100};
+  }
+  mem_istream ims{std::move(oms)};
+  ASSERT_EQ(ims.available(), 3UL);
+}
+
+TEST(CompactBinaryArchive, ContainersRoundTrip)
+{
+  const std::vector<std::string> strings{"a", "bc", "", "def"};
+  const std::vector<TrivialStruct> trivials{{1, 1.f}, {2, 2.f}};
+
+  mem_ostream oms;
+  {
+    compact_binary_oarchive oar{oms};
+    oar << strings;
+    oar << trivials;
+  }
+
+  mem_istream ims{std::move(oms)};
+  compact_binary_iarchive iar{ims};
+
+  std::vector<std::string> read_strings;
+  iar >> read_strings;
+  ASSERT_EQ(read_strings, strings);
+
+  std::vector<TrivialStruct> read_trivials;
+  iar >> read_trivials;
+  ASSERT_EQ(read_trivials.size(), trivials.size());
+  ASSERT_EQ(read_trivials.back().x, 2);
+}
+
+TEST(CompactBinaryArchive, SortedPacketRoundTrip)
+{
+  std::vector<std::uint32_t> ids(1000);
+  std::iota(ids.begin(), ids.end(), 100U);
+
+  mem_ostream oms;
+  {
+    compact_binary_oarchive oar{oms};
+    oar << make_sorted_packet(ids.data(), ids.size());
+  }
+
+  mem_istream ims{std::move(oms)};
+
+  // Encoded size, first value, then one byte per difference
+  ASSERT_EQ(ims.available(), 2UL + 1UL + ids.size() - 1UL);
+
+  std::vector<std::uint32_t> read_ids(ids.size());
+  compact_binary_iarchive iar{ims};
+  iar >> make_sorted_packet(read_ids.data(), read_ids.size());
+  ASSERT_EQ(read_ids, ids);
+}
+
+TEST(CompactBinaryArchive, UnsortedPacketRoundTrip)
+{
+  const std::vector<std::int32_t> values{5, -7, std::numeric_limits<std::int32_t>::max(), 0, -7};
+
+  mem_ostream oms;
+  {
+    compact_binary_oarchive oar{oms};
+    oar << make_sorted_packet(values.data(), values.size());
+  }
+
+  mem_istream ims{std::move(oms)};
+  std::vector<std::int32_t> read_values(values.size());
+  compact_binary_iarchive iar{ims};
+  iar >> make_sorted_packet(read_values.data(), read_values.size());
+  ASSERT_EQ(read_values, values);
+}
+
+TEST(CompactBinaryArchive, SortedPacketSizeMismatch)
+{
+  std::vector<std::uint32_t> ids{1, 2, 3};
+
+  mem_ostream oms;
+  {
+    compact_binary_oarchive oar{oms};
+    oar << make_sorted_packet(ids.data(), ids.size());
+  }
+
+  mem_istream ims{std::move(oms)};
+  std::vector<std::uint32_t> read_ids(4);
+  compact_binary_iarchive iar{ims};
+  ASSERT_THROW((iar >> make_sorted_packet(read_ids.data(), read_ids.size())), std::runtime_error);
+}
+
+TEST(BinaryArchive, SortedPacketIsPlainPacket)
+{
+  std::vector<std::uint32_t> ids{1, 2, 3};
+
+  mem_ostream oms;
+  {
+    binary_oarchive oar{oms};
+    oar << make_sorted_packet(ids.data(), ids.size());
+  }
+
+  mem_istream ims{std::move(oms)};
+  ASSERT_EQ(ims.available(), sizeof(std::uint32_t) * ids.size());
+
+  std::vector<std::uint32_t> read_ids(ids.size());
+  binary_iarchive iar{ims};
+  iar >> make_sorted_packet(read_ids.data(), read_ids.size());
+  ASSERT_EQ(read_ids, ids);
+}
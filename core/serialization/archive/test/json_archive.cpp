@@ -6,19 +6,29 @@
 
 // C++ Standard Library
 #include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 // GTest
 #include <gtest/gtest.h>
 
 // Tyl
-#include <tyl/serialization/file_istream.hpp>
 #include <tyl/serialization/file_ostream.hpp>
 #include <tyl/serialization/json_iarchive.hpp>
 #include <tyl/serialization/json_oarchive.hpp>
+#include <tyl/serialization/mem_istream.hpp>
+#include <tyl/serialization/mem_ostream.hpp>
 
 using namespace tyl::serialization;
 
+static mem_istream make_json_istream(std::string_view json)
+{
+  return mem_istream{std::vector<std::uint8_t>{json.begin(), json.end()}};
+}
+
 struct TrivialStruct
 {
   int x;
@@ -39,6 +49,11 @@ struct TrivialNestedStruct
   TrivialStruct second;
 };
 
+struct OnlyX
+{
+  int x;
+};
+
 static bool operator==(const TrivialNestedStruct& lhs, const TrivialNestedStruct& rhs)
 {
   return (lhs.label_1 == rhs.label_1) and (lhs.label_2 == rhs.label_2) and (lhs.first == rhs.first) and
@@ -58,6 +73,11 @@ template <typename Archive> struct serialize<Archive, ::TrivialStruct>
   }
 };
 
+template <typename Archive> struct serialize<Archive, ::OnlyX>
+{
+  void operator()(Archive& ar, ::OnlyX& value) { ar& named{"x", value.x}; }
+};
+
 template <typename Archive> struct serialize<Archive, ::TrivialNestedStruct>
 {
   void operator()(Archive& ar, ::TrivialNestedStruct& value)
@@ -161,19 +181,63 @@ TEST(JSONOArchive, ArrayOfTrivialStructs)
 }
 
 
+namespace
+{
+
+/**
+ * @brief Output stream which fails every write
+ */
+class failing_ostream : public ostream<failing_ostream>
+{
+  friend class ostream<failing_ostream>;
+
+  std::size_t write_impl(const void* ptr, std::size_t len) { throw std::runtime_error{"write failed"}; }
+};
+
+}  // namespace
+
+TEST(JSONOArchive, FlushReportsStreamError)
+{
+  failing_ostream os;
+  json_oarchive oar{os};
+  oar << named{"value", 1};
+  ASSERT_THROW(oar.flush(), std::runtime_error);
+}
+
+TEST(JSONOArchive, DestructorDoesNotThrowOnStreamError)
+{
+  failing_ostream os;
+  const auto write_and_close = [&os] {
+    json_oarchive oar{os};
+    oar << named{"value", 1};
+  };
+  ASSERT_NO_THROW(write_and_close());
+}
+
+TEST(JSONOArchive, DestructorDoesNotThrowWhileUnwinding)
+{
+  failing_ostream os;
+  const auto write_and_throw = [&os] {
+    json_oarchive oar{os};
+    oar << named{"value", 1};
+    throw std::logic_error{"unwinding"};
+  };
+  ASSERT_THROW(write_and_throw(), std::logic_error);
+}
+
 TEST(JSONIArchive, Primitive)
 {
   const float target = 0.1f;
 
+  mem_ostream oms;
   {
-    file_ostream ofs{"Primitive.json"};
-    json_oarchive oar{ofs};
+    json_oarchive oar{oms};
     ASSERT_NO_THROW((oar << named{"primitive", target}));
   }
 
   {
-    file_istream ifs{"Primitive.json"};
-    json_iarchive iar{ifs};
+    mem_istream ims{std::move(oms)};
+    json_iarchive iar{ims};
     float read_value;
     ASSERT_NO_THROW((iar >> named{"primitive", read_value}));
     ASSERT_EQ(target, read_value);
@@ -185,15 +249,15 @@ TEST(JSONIArchive, BoolTrue)
 {
   const bool target = true;
 
+  mem_ostream oms;
   {
-    file_ostream ofs{"BoolTrue.json"};
-    json_oarchive oar{ofs};
+    json_oarchive oar{oms};
     ASSERT_NO_THROW((oar << named{"bool", target}));
   }
 
   {
-    file_istream ifs{"BoolTrue.json"};
-    json_iarchive iar{ifs};
+    mem_istream ims{std::move(oms)};
+    json_iarchive iar{ims};
     bool read_value;
     ASSERT_NO_THROW((iar >> named{"bool", read_value}));
     ASSERT_EQ(target, read_value);
@@ -205,15 +269,15 @@ TEST(JSONIArchive, BoolFalse)
 {
   const bool target = false;
 
+  mem_ostream oms;
   {
-    file_ostream ofs{"BoolFalse.json"};
-    json_oarchive oar{ofs};
+    json_oarchive oar{oms};
     ASSERT_NO_THROW((oar << named{"bool", target}));
   }
 
   {
-    file_istream ifs{"BoolFalse.json"};
-    json_iarchive iar{ifs};
+    mem_istream ims{std::move(oms)};
+    json_iarchive iar{ims};
     bool read_value;
     ASSERT_NO_THROW((iar >> named{"bool", read_value}));
     ASSERT_EQ(target, read_value);
@@ -224,15 +288,15 @@ TEST(JSONIArchive, TrivialStruct)
 {
   const TrivialStruct target = {5, 123.f, 321.0};
 
+  mem_ostream oms;
   {
-    file_ostream ofs{"TrivialStruct.json"};
-    json_oarchive oar{ofs};
+    json_oarchive oar{oms};
     ASSERT_NO_THROW((oar << named{"trivial", target}));
   }
 
   {
-    file_istream ifs{"TrivialStruct.json"};
-    json_iarchive iar{ifs};
+    mem_istream ims{std::move(oms)};
+    json_iarchive iar{ims};
     TrivialStruct read_value;
     ASSERT_NO_THROW((iar >> named{"trivial", read_value}));
 
@@ -246,15 +310,15 @@ TEST(JSONIArchive, TrivialNestedStruct)
   const TrivialNestedStruct target = {"not", "    cool", {5, 123.f, 321.0}, {99, 193.f, 1221.0}};
   ;
 
+  mem_ostream oms;
   {
-    file_ostream ofs{"TrivialNestedStruct.json"};
-    json_oarchive oar{ofs};
+    json_oarchive oar{oms};
     ASSERT_NO_THROW((oar << named{"trivial_nested", target}));
   }
 
   {
-    file_istream ifs{"TrivialNestedStruct.json"};
-    json_iarchive iar{ifs};
+    mem_istream ims{std::move(oms)};
+    json_iarchive iar{ims};
     TrivialNestedStruct read_value;
     ASSERT_NO_THROW((iar >> named{"trivial_nested", read_value}));
 
@@ -266,15 +330,15 @@ TEST(JSONIArchive, ArrayOfPrimitives)
 {
   const std::vector<float> target = {1.f, 2.f, 3.f, 4.f, 5.f};
 
+  mem_ostream oms;
   {
-    file_ostream ofs{"ArrayOfPrimitives.json"};
-    json_oarchive oar{ofs};
+    json_oarchive oar{oms};
     ASSERT_NO_THROW((oar << named{"array", target}));
   }
 
   {
-    file_istream ifs{"ArrayOfPrimitives.json"};
-    json_iarchive iar{ifs};
+    mem_istream ims{std::move(oms)};
+    json_iarchive iar{ims};
     std::vector<float> read_value;
     ASSERT_NO_THROW((iar >> named{"array", read_value}));
 
@@ -287,18 +351,209 @@ TEST(JSONIArchive, ArrayOfTrivialStructs)
   const TrivialStruct target_element{5, 123.f, 321.0};
   const std::vector<TrivialStruct> target = {target_element, target_element, target_element};
 
+  mem_ostream oms;
   {
-    file_ostream ofs{"ArrayOfTrivialStructs.json"};
-    json_oarchive oar{ofs};
+    json_oarchive oar{oms};
     ASSERT_NO_THROW((oar << named{"array", target}));
   }
 
   {
-    file_istream ifs{"ArrayOfTrivialStructs.json"};
-    json_iarchive iar{ifs};
+    mem_istream ims{std::move(oms)};
+    json_iarchive iar{ims};
     std::vector<TrivialStruct> read_value;
     ASSERT_NO_THROW((iar >> named{"array", read_value}));
 
     ASSERT_EQ(target, read_value);
   }
 }
+
+TEST(JSONIArchive, OutOfOrderKeys)
+{
+  auto ifs = make_json_istream(R"({"trivial": {"z": 321.0, "unused": [1, {"a": "}"}], "y": 123.0, "x": 5}})");
+  json_iarchive iar{ifs};
+
+  TrivialStruct read_value;
+  ASSERT_NO_THROW((iar >> named{"trivial", read_value}));
+
+  const TrivialStruct target = {5, 123.f, 321.0};
+  ASSERT_EQ(target, read_value);
+}
+
+TEST(JSONIArchive, MissingKey)
+{
+  auto ifs = make_json_istream(R"({"trivial": {"x": 5, "z": 321.0}})");
+  json_iarchive iar{ifs};
+
+  TrivialStruct read_value;
+  ASSERT_THROW((iar >> named{"trivial", read_value}), std::runtime_error);
+}
+
+TEST(JSONIArchive, SignedAndExponentNumerics)
+{
+  auto ifs = make_json_istream(R"({"i": -42, "l": +7, "f": -1.5e3, "d": 2.5E-2})");
+  json_iarchive iar{ifs};
+
+  int i;
+  long l;
+  float f;
+  double d;
+  ASSERT_NO_THROW((iar >> named{"i", i}));
+  ASSERT_NO_THROW((iar >> named{"l", l}));
+  ASSERT_NO_THROW((iar >> named{"f", f}));
+  ASSERT_NO_THROW((iar >> named{"d", d}));
+
+  ASSERT_EQ(i, -42);
+  ASSERT_EQ(l, 7);
+  ASSERT_EQ(f, -1.5e3f);
+  ASSERT_EQ(d, 2.5e-2);
+}
+
+TEST(JSONIArchive, EscapedString)
+{
+  auto ifs = make_json_istream(R"({"s": "a \"quoted\" \\ line\n\u0041"})");
+  json_iarchive iar{ifs};
+
+  std::string read_value;
+  ASSERT_NO_THROW((iar >> named{"s", read_value}));
+  ASSERT_EQ(read_value, "a \"quoted\" \\ line\nA");
+}
+
+TEST(JSONIArchive, EscapedStringRoundTrip)
+{
+  const std::string target = "\"quoted\"\t\\ line\n\x01";
+
+  mem_ostream oms;
+  {
+    json_oarchive oar{oms};
+    ASSERT_NO_THROW((oar << named{"s", target}));
+  }
+
+  {
+    mem_istream ims{std::move(oms)};
+    json_iarchive iar{ims};
+    std::string read_value;
+    ASSERT_NO_THROW((iar >> named{"s", read_value}));
+    ASSERT_EQ(target, read_value);
+  }
+}
+
+TEST(JSONIArchive, LargeArrayOfPrimitives)
+{
+  std::vector<double> target;
+  for (int i = 0; i < 100000; ++i)
+  {
+    target.push_back(i * 0.1);
+  }
+
+  mem_ostream oms;
+  {
+    json_oarchive oar{oms};
+    ASSERT_NO_THROW((oar << named{"array", target}));
+  }
+
+  {
+    mem_istream ims{std::move(oms)};
+    json_iarchive iar{ims};
+    std::vector<double> read_value;
+    ASSERT_NO_THROW((iar >> named{"array", read_value}));
+    ASSERT_EQ(target, read_value);
+  }
+}
+
+TEST(JSONIArchive, Base64ArrayOfTrivialStructs)
+{
+  const TrivialStruct target_element{5, 123.f, 321.0};
+  const std::vector<TrivialStruct> target(50000, target_element);
+
+  mem_ostream oms;
+  {
+    json_oarchive<mem_ostream, json_packet_format::base64> oar{oms};
+    ASSERT_NO_THROW((oar << named{"array", target}));
+  }
+
+  {
+    mem_istream ims{std::move(oms)};
+    json_iarchive<mem_istream, json_packet_format::base64> iar{ims};
+    std::vector<TrivialStruct> read_value;
+    ASSERT_NO_THROW((iar >> named{"array", read_value}));
+    ASSERT_EQ(target, read_value);
+  }
+}
+
+TEST(JSONIArchive, Base64PacketSizeMismatch)
+{
+  auto ifs = make_json_istream(R"({"array": {"size": 2, "data": "AAAA"}})");
+  json_iarchive<mem_istream, json_packet_format::base64> iar{ifs};
+
+  std::vector<float> read_value;
+  ASSERT_THROW((iar >> named{"array", read_value}), std::runtime_error);
+}
+
+namespace
+{
+
+std::string make_large_array_json(const std::size_t size)
+{
+  std::string json = R"({"size": )" + std::to_string(size) + R"(, "data": [)";
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    json += (i == 0) ? "" : ", ";
+    json += std::to_string(i);
+  }
+  return json + "]}";
+}
+
+}  // namespace
+
+TEST(JSONIArchive, OutOfOrderKeysAfterLargeArray)
+{
+  static constexpr std::size_t kSize = 100000;
+  const auto json =
+    R"({"array": )" + make_large_array_json(kSize) + R"(, "trivial": {"z": 321.0, "y": 123.0, "x": 5}})";
+  auto ifs = make_json_istream(json);
+  json_iarchive iar{ifs};
+
+  std::vector<int> read_array;
+  TrivialStruct read_trivial;
+  ASSERT_NO_THROW((iar >> named{"array", read_array}));
+  ASSERT_NO_THROW((iar >> named{"trivial", read_trivial}));
+
+  ASSERT_EQ(read_array.size(), kSize);
+  ASSERT_EQ(read_array.back(), static_cast<int>(kSize - 1));
+  const TrivialStruct target = {5, 123.f, 321.0};
+  ASSERT_EQ(target, read_trivial);
+}
+
+TEST(JSONIArchive, OutOfOrderKeysBeforeLargeArray)
+{
+  static constexpr std::size_t kSize = 100000;
+  const auto json = R"({"trivial": {"x": 5, "y": 123.0, "z": 321.0}, "array": )" + make_large_array_json(kSize) + "}";
+  auto ifs = make_json_istream(json);
+  json_iarchive iar{ifs};
+
+  std::vector<int> read_array;
+  TrivialStruct read_trivial;
+  ASSERT_NO_THROW((iar >> named{"array", read_array}));
+  ASSERT_NO_THROW((iar >> named{"trivial", read_trivial}));
+
+  ASSERT_EQ(read_array.size(), kSize);
+  const TrivialStruct target = {5, 123.f, 321.0};
+  ASSERT_EQ(target, read_trivial);
+}
+
+TEST(JSONIArchive, SkippedStringWithEscapedQuoteAcrossBlocks)
+{
+  // Places the backslash escaping a quote at the end of the first block read from the stream
+  std::string json = R"({"o": {"x": 1, "s": ")";
+  json.resize(json_iarchive<mem_istream>::read_block_size - 1, 'a');
+  json += R"(\"b"}, "y": 2})";
+  auto ifs = make_json_istream(json);
+  json_iarchive iar{ifs};
+
+  OnlyX read_o;
+  int read_y;
+  ASSERT_NO_THROW((iar >> named{"o", read_o}));
+  ASSERT_NO_THROW((iar >> named{"y", read_y}));
+  ASSERT_EQ(read_o.x, 1);
+  ASSERT_EQ(read_y, 2);
+}
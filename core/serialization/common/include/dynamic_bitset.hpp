@@ -0,0 +1,56 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file dynamic_bitset.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <vector>
+
+// Tyl
+#include <tyl/dynamic_bitset.hpp>
+#include <tyl/serialization/named.hpp>
+#include <tyl/serialization/object.hpp>
+#include <tyl/serialization/packet.hpp>
+
+namespace tyl::serialization
+{
+
+template <typename OArchiveT, typename BlockT, typename Alloc, std::size_t InlineBlockCount>
+struct save<OArchiveT, dynamic_bitset<BlockT, Alloc, InlineBlockCount>>
+{
+  void operator()(OArchiveT& oar, const dynamic_bitset<BlockT, Alloc, InlineBlockCount>& bitset)
+  {
+    oar << named{"size", bitset.size()};
+
+    // Bits past size() in the last block are unspecified; they are saved as zeros, so equal bitsets save identically
+    const std::size_t n = bitset.blocks();
+    if (n == 0 or (bitset.block_data()[n - 1] & ~bitset.tail_mask()) == 0)
+    {
+      oar << named{"blocks", make_packet(bitset.block_data(), n)};
+    }
+    else
+    {
+      std::vector<BlockT> blocks{bitset.block_data(), bitset.block_data() + n};
+      blocks.back() &= bitset.tail_mask();
+      oar << named{"blocks", make_packet(blocks.data(), n)};
+    }
+  }
+};
+
+template <typename IArchiveT, typename BlockT, typename Alloc, std::size_t InlineBlockCount>
+struct load<IArchiveT, dynamic_bitset<BlockT, Alloc, InlineBlockCount>>
+{
+  void operator()(IArchiveT& iar, dynamic_bitset<BlockT, Alloc, InlineBlockCount>& bitset)
+  {
+    std::size_t size{0};
+    iar >> named{"size", size};
+    bitset.clear();
+    bitset.resize(size);
+    iar >> named{"blocks", make_packet(bitset.block_data(), bitset.blocks())};
+  }
+};
+
+}  // namespace tyl::serialization
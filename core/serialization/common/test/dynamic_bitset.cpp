@@ -0,0 +1,82 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file dynamic_bitset.cpp
+ */
+
+// C++ Standard Library
+#include <cstdint>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Tyl
+#include <tyl/serialization/binary_archive.hpp>
+#include <tyl/serialization/common/dynamic_bitset.hpp>
+#include <tyl/serialization/mem_stream.hpp>
+#include <tyl/serialization/named.hpp>
+
+using namespace tyl::serialization;
+
+TEST(DynamicBitset, Inline)
+{
+  tyl::dynamic_bitset<std::uint64_t> expected{70};
+  expected.set(3);
+  expected.set(69);
+
+  mem_ostream oms{};
+  {
+    binary_oarchive oar{oms};
+    ASSERT_NO_THROW((oar << named{"value", expected}));
+  }
+
+  mem_istream ims{std::move(oms)};
+  {
+    binary_iarchive iar{ims};
+    tyl::dynamic_bitset<std::uint64_t> read;
+    ASSERT_NO_THROW((iar >> named{"value", read}));
+    ASSERT_EQ(read, expected);
+  }
+}
+
+TEST(DynamicBitset, Allocated)
+{
+  tyl::dynamic_bitset<std::uint64_t> expected{1000};
+  expected.set(10, 900);
+
+  mem_ostream oms{};
+  {
+    binary_oarchive oar{oms};
+    ASSERT_NO_THROW((oar << named{"value", expected}));
+  }
+
+  mem_istream ims{std::move(oms)};
+  {
+    binary_iarchive iar{ims};
+    tyl::dynamic_bitset<std::uint64_t> read{5, true};
+    ASSERT_NO_THROW((iar >> named{"value", read}));
+    ASSERT_EQ(read, expected);
+  }
+}
+
+TEST(DynamicBitset, BitsPastSizeSavedAsZero)
+{
+  tyl::dynamic_bitset<std::uint64_t> expected{128, true};
+  expected.resize(70);
+  ASSERT_NE(expected.block_data()[1] & ~expected.tail_mask(), 0UL);
+
+  mem_ostream oms{};
+  {
+    binary_oarchive oar{oms};
+    ASSERT_NO_THROW((oar << named{"value", expected}));
+  }
+
+  mem_istream ims{std::move(oms)};
+  {
+    binary_iarchive iar{ims};
+    tyl::dynamic_bitset<std::uint64_t> read;
+    ASSERT_NO_THROW((iar >> named{"value", read}));
+    ASSERT_EQ(read, expected);
+    ASSERT_EQ(read.block_data()[1], read.tail_mask());
+  }
+}
@@ -86,6 +86,14 @@ template <typename ArchiveT, typename ObjectT> struct is_trivially_serializable
 template <typename ArchiveT, typename ObjectT>
 const bool is_trivially_serializable_v = is_trivially_serializable<ArchiveT, ObjectT>::value;
 
+/**
+ * @brief Checks whether an archive records labels, rather than ignoring them
+ */
+template <typename ArchiveT> struct archive_uses_labels : std::false_type
+{};
+
+template <typename ArchiveT> constexpr bool archive_uses_labels_v = archive_uses_labels<ArchiveT>::value;
+
 /**
  * @brief Proxy object for use during de-serialization while bypassing default object construction
  */
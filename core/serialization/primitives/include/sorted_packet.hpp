@@ -0,0 +1,64 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file sorted_packet.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstdint>
+#include <type_traits>
+
+// Tyl
+#include <tyl/serialization/object.hpp>
+#include <tyl/serialization/packet.hpp>
+
+namespace tyl::serialization
+{
+
+/**
+ * @brief Array of integers, expected to be sorted in ascending order
+ *
+ *        Archives which encode integers compactly may store these as differences between successive values. Other
+ *        archives store them as a plain packet. Unsorted arrays round-trip correctly, but may not be stored compactly.
+ */
+template <typename ValueT> struct sorted_packet
+{
+  static_assert(
+    std::is_integral_v<std::remove_const_t<ValueT>> or std::is_enum_v<std::remove_const_t<ValueT>>,
+    "'ValueT' must be an integral or enum type");
+  ValueT* data;
+  std::size_t len;
+};
+
+template <typename ValueT> constexpr sorted_packet<ValueT> make_sorted_packet(ValueT* data, std::size_t element_count)
+{
+  return sorted_packet<ValueT>{data, element_count};
+}
+
+template <typename T> struct is_sorted_packet : std::false_type
+{};
+
+template <typename ValueT> struct is_sorted_packet<sorted_packet<ValueT>> : std::true_type
+{};
+
+template <typename T>
+static constexpr bool is_sorted_packet_v = is_sorted_packet<std::remove_const_t<std::remove_reference_t<T>>>::value;
+
+/**
+ * @brief Archive-generic <code>sorted_packet<ValueT></code> save implementation
+ */
+template <typename OArchive, typename ValueT> struct save<OArchive, sorted_packet<ValueT>>
+{
+  void operator()(OArchive& ar, const sorted_packet<ValueT>& p) { ar << make_packet(p.data, p.len); }
+};
+
+/**
+ * @brief Archive-generic <code>sorted_packet<ValueT></code> load implementation
+ */
+template <typename IArchive, typename ValueT> struct load<IArchive, sorted_packet<ValueT>>
+{
+  void operator()(IArchive& ar, sorted_packet<ValueT> p) { ar >> make_packet(p.data, p.len); }
+};
+
+}  // namespace tyl::serialization
@@ -0,0 +1,215 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file reflect.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+
+// Tyl
+#include <tyl/serialization/iarchive.hpp>
+#include <tyl/serialization/named.hpp>
+#include <tyl/serialization/object.hpp>
+#include <tyl/serialization/packet.hpp>
+#include <tyl/serialization/varint.hpp>
+
+namespace tyl::serialization
+{
+
+/**
+ * @brief Describes a single reflected data member of \c ObjectT
+ */
+template <typename ObjectT, typename ValueT> struct reflected_field
+{
+  using object_type = ObjectT;
+  using value_type = ValueT;
+
+  /// Name of the field, used as its label
+  const char* name;
+  /// Pointer to the field
+  ValueT ObjectT::*member;
+  /// Offset of field from start of ObjectT, in bytes
+  std::size_t offset;
+};
+
+/**
+ * @brief Lists reflected data members of \c ObjectT, in declaration order
+ *
+ *        Specializations provide a <code>static constexpr</code> tuple of reflected_field called \c fields
+ */
+template <typename ObjectT> struct reflect;
+
+/**
+ * @brief Generates serialization for \c ObjectT from reflect<ObjectT>
+ *
+ *        For archives which use labels, each field is serialized as a named value. Otherwise, runs of adjacent
+ *        trivially serializable fields with no padding between them are serialized together as a single packet.
+ *        For archives which use varints, integer fields are never packed, so that they are still stored compactly.
+ */
+template <typename ArchiveT, typename ObjectT> struct serialize_reflected
+{
+  void operator()(ArchiveT& ar, ObjectT& object)
+  {
+    if constexpr (archive_uses_labels_v<ArchiveT>)
+    {
+      std::apply([&ar, &object](const auto&... f) { ((ar & named{f.name, object.*(f.member)}), ...); }, fields);
+    }
+    else
+    {
+      serialize_reflected::apply<0>(ar, object);
+    }
+  }
+
+private:
+  static constexpr auto& fields = reflect<ObjectT>::fields;
+
+  static constexpr std::size_t field_count = std::tuple_size_v<std::remove_reference_t<decltype(fields)>>;
+
+  template <std::size_t I>
+  using field_value_t = typename std::tuple_element_t<I, std::remove_reference_t<decltype(fields)>>::value_type;
+
+  /**
+   * @brief Checks if field \c I may be serialized as part of a packet
+   */
+  template <std::size_t I> static constexpr bool is_packable()
+  {
+    return is_trivially_serializable_v<ArchiveT, field_value_t<I>> and
+      !(archive_uses_varints_v<ArchiveT> and is_varint_encodable_v<field_value_t<I>>);
+  }
+
+  /**
+   * @brief Checks if field \c I may be serialized in the same packet as the field before it
+   */
+  template <std::size_t I> static constexpr bool extends_packet()
+  {
+    if constexpr (I == 0 or I >= field_count)
+    {
+      return false;
+    }
+    else
+    {
+      return std::is_standard_layout_v<ObjectT> and is_packable<I - 1>() and is_packable<I>() and
+        (std::get<I - 1>(fields).offset + sizeof(field_value_t<I - 1>) == std::get<I>(fields).offset);
+    }
+  }
+
+  /**
+   * @brief Returns one past the last field in the packet which starts at field \c I
+   */
+  template <std::size_t I> static constexpr std::size_t packet_end()
+  {
+    if constexpr (extends_packet<I + 1>())
+    {
+      return packet_end<I + 1>();
+    }
+    else
+    {
+      return I + 1;
+    }
+  }
+
+  template <std::size_t I> static void apply(ArchiveT& ar, ObjectT& object)
+  {
+    if constexpr (I < field_count)
+    {
+      constexpr std::size_t last = packet_end<I>();
+      if constexpr (last - I == 1)
+      {
+        ar & object.*(std::get<I>(fields).member);
+      }
+      else
+      {
+        constexpr std::size_t offset = std::get<I>(fields).offset;
+        constexpr std::size_t len = std::get<last - 1>(fields).offset + sizeof(field_value_t<last - 1>) - offset;
+
+        auto* const data = reinterpret_cast<std::uint8_t*>(std::addressof(object)) + offset;
+        if constexpr (std::is_base_of_v<iarchive<ArchiveT>, ArchiveT>)
+        {
+          ar >> make_packet(data, len);
+        }
+        else
+        {
+          ar << make_packet(static_cast<const std::uint8_t*>(data), len);
+        }
+      }
+      serialize_reflected::apply<last>(ar, object);
+    }
+  }
+};
+
+}  // namespace tyl::serialization
+
+// clang-format off
+#define TYL_REFLECT_EXPAND(x) x
+#define TYL_REFLECT_SELECT(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, N, ...) N
+#define TYL_REFLECT_FIELDS_1(T, f) TYL_REFLECT_FIELD(T, f)
+#define TYL_REFLECT_FIELDS_2(T, f, ...) TYL_REFLECT_FIELD(T, f), TYL_REFLECT_EXPAND(TYL_REFLECT_FIELDS_1(T, __VA_ARGS__))
+#define TYL_REFLECT_FIELDS_3(T, f, ...) TYL_REFLECT_FIELD(T, f), TYL_REFLECT_EXPAND(TYL_REFLECT_FIELDS_2(T, __VA_ARGS__))
+#define TYL_REFLECT_FIELDS_4(T, f, ...) TYL_REFLECT_FIELD(T, f), TYL_REFLECT_EXPAND(TYL_REFLECT_FIELDS_3(T, __VA_ARGS__))
+#define TYL_REFLECT_FIELDS_5(T, f, ...) TYL_REFLECT_FIELD(T, f), TYL_REFLECT_EXPAND(TYL_REFLECT_FIELDS_4(T, __VA_ARGS__))
+#define TYL_REFLECT_FIELDS_6(T, f, ...) TYL_REFLECT_FIELD(T, f), TYL_REFLECT_EXPAND(TYL_REFLECT_FIELDS_5(T, __VA_ARGS__))
+#define TYL_REFLECT_FIELDS_7(T, f, ...) TYL_REFLECT_FIELD(T, f), TYL_REFLECT_EXPAND(TYL_REFLECT_FIELDS_6(T, __VA_ARGS__))
+#define TYL_REFLECT_FIELDS_8(T, f, ...) TYL_REFLECT_FIELD(T, f), TYL_REFLECT_EXPAND(TYL_REFLECT_FIELDS_7(T, __VA_ARGS__))
+#define TYL_REFLECT_FIELDS_9(T, f, ...) TYL_REFLECT_FIELD(T, f), TYL_REFLECT_EXPAND(TYL_REFLECT_FIELDS_8(T, __VA_ARGS__))
+#define TYL_REFLECT_FIELDS_10(T, f, ...) TYL_REFLECT_FIELD(T, f), TYL_REFLECT_EXPAND(TYL_REFLECT_FIELDS_9(T, __VA_ARGS__))
+#define TYL_REFLECT_FIELDS_11(T, f, ...) TYL_REFLECT_FIELD(T, f), TYL_REFLECT_EXPAND(TYL_REFLECT_FIELDS_10(T, __VA_ARGS__))
+#define TYL_REFLECT_FIELDS_12(T, f, ...) TYL_REFLECT_FIELD(T, f), TYL_REFLECT_EXPAND(TYL_REFLECT_FIELDS_11(T, __VA_ARGS__))
+#define TYL_REFLECT_FIELDS_13(T, f, ...) TYL_REFLECT_FIELD(T, f), TYL_REFLECT_EXPAND(TYL_REFLECT_FIELDS_12(T, __VA_ARGS__))
+#define TYL_REFLECT_FIELDS_14(T, f, ...) TYL_REFLECT_FIELD(T, f), TYL_REFLECT_EXPAND(TYL_REFLECT_FIELDS_13(T, __VA_ARGS__))
+#define TYL_REFLECT_FIELDS_15(T, f, ...) TYL_REFLECT_FIELD(T, f), TYL_REFLECT_EXPAND(TYL_REFLECT_FIELDS_14(T, __VA_ARGS__))
+#define TYL_REFLECT_FIELDS_16(T, f, ...) TYL_REFLECT_FIELD(T, f), TYL_REFLECT_EXPAND(TYL_REFLECT_FIELDS_15(T, __VA_ARGS__))
+// clang-format on
+
+/**
+ * @brief Creates a reflected_field for data member \c field of \c Type
+ *
+ * @note \c Type should be standard-layout, since offsetof is only conditionally supported otherwise; fields of
+ *       types which are not standard-layout are never coalesced into packets
+ */
+#define TYL_REFLECT_FIELD(Type, field)                                                                                 \
+  ::tyl::serialization::reflected_field<Type, decltype(Type::field)>                                                   \
+  {                                                                                                                    \
+    #field, &Type::field, offsetof(Type, field)                                                                        \
+  }
+
+/**
+ * @brief Expands to a comma-separated list of reflected_field, one for each of up to 16 data members of \c Type
+ */
+#define TYL_REFLECT_FIELDS(Type, ...)                                                                                  \
+  TYL_REFLECT_EXPAND(TYL_REFLECT_SELECT(                                                                               \
+    __VA_ARGS__,                                                                                                       \
+    TYL_REFLECT_FIELDS_16,                                                                                             \
+    TYL_REFLECT_FIELDS_15,                                                                                             \
+    TYL_REFLECT_FIELDS_14,                                                                                             \
+    TYL_REFLECT_FIELDS_13,                                                                                             \
+    TYL_REFLECT_FIELDS_12,                                                                                             \
+    TYL_REFLECT_FIELDS_11,                                                                                             \
+    TYL_REFLECT_FIELDS_10,                                                                                             \
+    TYL_REFLECT_FIELDS_9,                                                                                              \
+    TYL_REFLECT_FIELDS_8,                                                                                              \
+    TYL_REFLECT_FIELDS_7,                                                                                              \
+    TYL_REFLECT_FIELDS_6,                                                                                              \
+    TYL_REFLECT_FIELDS_5,                                                                                              \
+    TYL_REFLECT_FIELDS_4,                                                                                              \
+    TYL_REFLECT_FIELDS_3,                                                                                              \
+    TYL_REFLECT_FIELDS_2,                                                                                              \
+    TYL_REFLECT_FIELDS_1)(Type, __VA_ARGS__))
+
+/**
+ * @brief Generates serialization for \c Type from a list of its data members
+ *
+ *        Must be used within namespace \c tyl::serialization. For class templates, specialize reflect and serialize
+ *        (deriving from serialize_reflected) directly, using TYL_REFLECT_FIELDS.
+ */
+#define TYL_REFLECT(Type, ...)                                                                                         \
+  template <> struct reflect<Type>                                                                                     \
+  {                                                                                                                    \
+    static constexpr auto fields = std::make_tuple(TYL_REFLECT_FIELDS(Type, __VA_ARGS__));                             \
+  };                                                                                                                   \
+  template <typename ArchiveT> struct serialize<ArchiveT, Type> : serialize_reflected<ArchiveT, Type>                  \
+  {}
@@ -0,0 +1,37 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file memory_resource.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <memory>
+#include <memory_resource>
+#include <new>
+
+namespace tyl::serialization
+{
+
+/**
+ * @brief Moves a pmr container which uses the default memory resource onto the memory resource of an archive
+ *
+ *        pmr allocators do not propagate on assignment, so the container is re-created in place. Its contents are
+ *        discarded, since they are about to be replaced by loaded values. Containers which were given some other
+ *        memory resource keep it.
+ */
+template <typename IArchiveT, typename ContainerT>
+void adopt_archive_memory_resource(IArchiveT& iar, ContainerT& container)
+{
+  using allocator_type = typename ContainerT::allocator_type;
+
+  std::pmr::memory_resource* const resource = iar.memory_resource();
+  std::pmr::memory_resource* const current = container.get_allocator().resource();
+  if (current != resource and current == std::pmr::get_default_resource())
+  {
+    std::destroy_at(std::addressof(container));
+    ::new (std::addressof(container)) ContainerT{allocator_type{resource}};
+  }
+}
+
+}  // namespace tyl::serialization
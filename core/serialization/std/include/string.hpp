@@ -6,12 +6,14 @@
 #pragma once
 
 // C++ Standard Library
+#include <memory_resource>
 #include <string>
 
 // Tyl
 #include <tyl/serialization/named.hpp>
 #include <tyl/serialization/object.hpp>
 #include <tyl/serialization/packet.hpp>
+#include <tyl/serialization/std/memory_resource.hpp>
 
 namespace tyl::serialization
 {
@@ -38,4 +40,17 @@ struct load<IArchiveT, std::basic_string<CharT, Traits, Allocator>>
   }
 };
 
+template <typename IArchiveT, typename CharT, typename Traits>
+struct load<IArchiveT, std::basic_string<CharT, Traits, std::pmr::polymorphic_allocator<CharT>>>
+{
+  void operator()(IArchiveT& iar, std::basic_string<CharT, Traits, std::pmr::polymorphic_allocator<CharT>>& str)
+  {
+    adopt_archive_memory_resource(iar, str);
+    std::size_t len{0};
+    iar >> named{"len", len};
+    str.resize(len);
+    iar >> named{"data", make_packet(str.data(), str.size())};
+  }
+};
+
 }  // namespace tyl::serialization
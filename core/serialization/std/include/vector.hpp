@@ -6,6 +6,7 @@
 #pragma once
 
 // C++ Standard Library
+#include <memory_resource>
 #include <vector>
 
 // Tyl
@@ -13,6 +14,7 @@
 #include <tyl/serialization/object.hpp>
 #include <tyl/serialization/packet.hpp>
 #include <tyl/serialization/sequence.hpp>
+#include <tyl/serialization/std/memory_resource.hpp>
 
 namespace tyl::serialization
 {
@@ -53,4 +55,25 @@ struct load<IArchiveT, std::vector<ValueT, Allocator>>
   }
 };
 
+template <typename IArchiveT, typename ValueT>
+struct load<IArchiveT, std::vector<ValueT, std::pmr::polymorphic_allocator<ValueT>>>
+{
+  void operator()(IArchiveT& iar, std::vector<ValueT, std::pmr::polymorphic_allocator<ValueT>>& vec)
+  {
+    adopt_archive_memory_resource(iar, vec);
+    std::size_t len{0};
+    iar >> named{"len", len};
+    // Elements are constructed with the vector's memory resource, so nested pmr containers share it
+    vec.resize(len);
+    if constexpr (is_trivially_serializable_v<IArchiveT, ValueT>)
+    {
+      iar >> named{"data", make_packet(vec.data(), vec.size())};
+    }
+    else
+    {
+      iar >> named{"data", make_sequence(vec.begin(), vec.end())};
+    }
+  }
+};
+
 }  // namespace tyl::serialization
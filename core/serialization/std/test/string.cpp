@@ -5,7 +5,9 @@
  */
 
 // C++ Standard Library
+#include <memory_resource>
 #include <string>
+#include <string_view>
 
 // GTest
 #include <gtest/gtest.h>
@@ -56,3 +58,26 @@ TEST(StdString, NonEmptyString)
     ASSERT_EQ(read, kExpected);
   }
 }
+
+TEST(StdString, PmrStringUsesArchiveMemoryResource)
+{
+  const std::string kExpected = "a string which is long enough to need heap storage";
+
+  mem_ostream oms{};
+  {
+    binary_oarchive oar{oms};
+    ASSERT_NO_THROW((oar << named{"value", kExpected}));
+  }
+
+  mem_istream ims{std::move(oms)};
+  {
+    std::pmr::monotonic_buffer_resource arena;
+    binary_iarchive iar{ims};
+    iar.set_memory_resource(&arena);
+
+    std::pmr::string read;
+    ASSERT_NO_THROW((iar >> named{"value", read}));
+    ASSERT_EQ(read.get_allocator().resource(), &arena);
+    ASSERT_EQ(std::string_view{read}, kExpected);
+  }
+}
@@ -5,7 +5,10 @@
  */
 
 // C++ Standard Library
+#include <algorithm>
+#include <memory_resource>
 #include <string>
+#include <string_view>
 #include <vector>
 
 // GTest
@@ -58,3 +61,55 @@ TEST(StdVector, NonTriviallySerializableElement)
     ASSERT_EQ(read, kExpected);
   }
 }
+
+TEST(StdVector, PmrVectorUsesArchiveMemoryResource)
+{
+  const std::vector<std::string> kExpected = {"short", "a string which is long enough to need heap storage"};
+
+  mem_ostream oms{};
+  {
+    binary_oarchive oar{oms};
+    ASSERT_NO_THROW((oar << named{"value", kExpected}));
+  }
+
+  mem_istream ims{std::move(oms)};
+  {
+    std::pmr::monotonic_buffer_resource arena;
+    binary_iarchive iar{ims};
+    iar.set_memory_resource(&arena);
+
+    std::pmr::vector<std::pmr::string> read;
+    ASSERT_NO_THROW((iar >> named{"value", read}));
+    ASSERT_EQ(read.get_allocator().resource(), &arena);
+    ASSERT_EQ(read.size(), kExpected.size());
+    for (std::size_t i = 0; i < kExpected.size(); ++i)
+    {
+      ASSERT_EQ(read[i].get_allocator().resource(), &arena);
+      ASSERT_EQ(std::string_view{read[i]}, kExpected[i]);
+    }
+  }
+}
+
+TEST(StdVector, PmrVectorKeepsExplicitMemoryResource)
+{
+  const std::vector<int> kExpected = {1, 2, 3, 4, 5};
+
+  mem_ostream oms{};
+  {
+    binary_oarchive oar{oms};
+    ASSERT_NO_THROW((oar << named{"value", kExpected}));
+  }
+
+  mem_istream ims{std::move(oms)};
+  {
+    std::pmr::monotonic_buffer_resource arena;
+    std::pmr::unsynchronized_pool_resource pool;
+    binary_iarchive iar{ims};
+    iar.set_memory_resource(&arena);
+
+    std::pmr::vector<int> read{&pool};
+    ASSERT_NO_THROW((iar >> named{"value", read}));
+    ASSERT_EQ(read.get_allocator().resource(), &pool);
+    ASSERT_TRUE(std::equal(read.begin(), read.end(), kExpected.begin(), kExpected.end()));
+  }
+}
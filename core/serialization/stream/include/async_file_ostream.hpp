@@ -0,0 +1,148 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file async_file_ostream.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// Tyl
+#include <tyl/serialization/ostream.hpp>
+
+namespace tyl::serialization
+{
+
+/**
+ * @brief Options for async_file_ostream
+ */
+struct async_file_ostream_options
+{
+  /// Number of bytes buffered before they are handed off to be written
+  std::size_t buffer_size = 1UL * 1024UL * 1024UL;
+  /// Number of full buffers which may wait to be written before writes block; bounds memory use to
+  /// (max_pending_buffers + 1) * buffer_size, which is double-buffered by default
+  std::size_t max_pending_buffers = 1;
+  /// If true, bytes are written to a temporary file, which replaces the target file only once all writes succeed
+  bool atomic = true;
+};
+
+/**
+ * @brief File output stream which writes to disk on a background thread
+ *
+ *        Written bytes are copied into in-memory buffers. Full buffers are handed to a writer thread, and emptied
+ *        buffers are recycled. Writing to this stream only waits on the disk once it is ahead of the writer thread by
+ *        async_file_ostream_options::max_pending_buffers buffers.
+ */
+class async_file_ostream final : public ostream<async_file_ostream>
+{
+  friend class ostream<async_file_ostream>;
+
+public:
+  explicit async_file_ostream(const std::filesystem::path& path, const async_file_ostream_options& options = {});
+
+  async_file_ostream(async_file_ostream&& other);
+
+  /**
+   * @brief Closes the stream, if not already closed, and waits until all pending writes have finished
+   */
+  ~async_file_ostream();
+
+  /**
+   * @brief Hands all buffered bytes off to be written
+   *
+   * @return future which is set once all bytes written so far are on disk; true if all writes succeeded, or false
+   *         immediately if the stream is closed
+   */
+  [[nodiscard]] std::future<bool> flush_async();
+
+  /**
+   * @brief Hands all buffered bytes off to be written, then closes the file
+   *
+   *        In atomic mode, the temporary file is renamed to the target path once all writes succeed, or removed
+   *        otherwise. The target file is never left partially written.
+   *
+   * @return future which is set once the file is closed; true if all writes succeeded, or false immediately if the
+   *         stream is already closed
+   *
+   * @throws std::runtime_error on any write after the stream is closed
+   */
+  [[nodiscard]] std::future<bool> close();
+
+private:
+  /**
+   * @copydoc ostream<async_file_ostream>::write
+   */
+  std::size_t write_impl(const void* ptr, std::size_t len)
+  {
+    if (closed_)
+    {
+      throw std::runtime_error{"write to closed async_file_ostream"};
+    }
+
+    const auto* bytes = static_cast<const std::uint8_t*>(ptr);
+    for (std::size_t remaining = len; remaining > 0;)
+    {
+      const std::size_t n = std::min(remaining, buffer_size_ - buffer_.size());
+      buffer_.insert(buffer_.end(), bytes, bytes + n);
+      bytes += n;
+      remaining -= n;
+
+      if (buffer_.size() == buffer_size_)
+      {
+        async_file_ostream::submit();
+      }
+    }
+    return len;
+  }
+
+  /**
+   * @copydoc ostream<async_file_ostream>::flush
+   *
+   * @note hands off buffered bytes without waiting for them to be written; see flush_async
+   */
+  void flush_impl()
+  {
+    if (!closed_)
+    {
+      async_file_ostream::submit();
+    }
+  }
+
+  /**
+   * @brief Hands current buffer off to the writer thread and replaces it with a recycled one
+   *
+   *        Waits for a buffer to be written first if too many are already pending
+   */
+  void submit();
+
+  struct writer;
+
+  /// State shared with the writer thread
+  std::unique_ptr<writer> writer_;
+
+  /// Writes buffers which have been handed off; joined on destruction
+  std::thread writer_thread_;
+
+  /// Set once the stream is closed
+  bool closed_ = false;
+
+  /// Number of bytes buffered before they are handed off to be written
+  std::size_t buffer_size_;
+
+  /// Number of full buffers which may wait to be written before writes block
+  std::size_t max_pending_buffers_;
+
+  /// Bytes which have not yet been handed off to be written
+  std::vector<std::uint8_t> buffer_;
+};
+
+}  // namespace tyl::serialization
@@ -27,6 +27,7 @@ public:
   file_handle_istream(file_handle_istream&& other) :
       file_bytes_remaining_{other.file_bytes_remaining_}, file_handle_{other.file_handle_}
   {
+    other.file_bytes_remaining_ = 0;
     other.file_handle_ = nullptr;
   }
 
@@ -0,0 +1,35 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file lz4.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstdint>
+
+namespace tyl::serialization
+{
+
+/**
+ * @brief Returns the largest possible size of \c len bytes after LZ4 block compression
+ */
+constexpr std::size_t lz4_compress_bound(const std::size_t len) { return len + (len / 255) + 16; }
+
+/**
+ * @brief Compresses \c len bytes at \c src into an LZ4 block at \c dst
+ *
+ * @param capacity  size of \c dst, in bytes; always sufficient if at least <code>lz4_compress_bound(len)</code>
+ *
+ * @return size of compressed block, in bytes; or 0 if it would not fit in \c capacity
+ */
+std::size_t lz4_compress(const void* src, std::size_t len, void* dst, std::size_t capacity);
+
+/**
+ * @brief Decompresses an LZ4 block of \c len bytes at \c src into exactly \c raw_len bytes at \c dst
+ *
+ * @return false if block is malformed, or does not decompress to exactly \c raw_len bytes
+ */
+bool lz4_decompress(const void* src, std::size_t len, void* dst, std::size_t raw_len);
+
+}  // namespace tyl::serialization
@@ -0,0 +1,69 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file lz4_frame.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstdint>
+
+namespace tyl::async
+{
+class JobSystem;
+}  // namespace tyl::async
+
+namespace tyl::serialization
+{
+
+/**
+ * @brief Options for LZ4 stream adaptors
+ */
+struct lz4_stream_options
+{
+  /// Maximum number of uncompressed bytes per block
+  std::size_t block_size = 256UL * 1024UL;
+  /// Number of blocks which may be compressed concurrently
+  std::size_t concurrency = 1;
+  /// Job system on which blocks are compressed concurrently; blocks are compressed on the writing thread if null
+  async::JobSystem* jobs = nullptr;
+};
+
+/// Identifies a stream as an LZ4 frame
+static constexpr char lz4_frame_magic[4] = {'T', 'Y', 'L', 'Z'};
+
+/// Largest supported block size
+static constexpr std::size_t lz4_frame_max_block_size = 64UL * 1024UL * 1024UL;
+
+/// Set in lz4_block_header::stored_size if block is stored without compression
+static constexpr std::uint32_t lz4_block_uncompressed_flag = 0x80000000;
+
+/**
+ * @brief Leading section of an LZ4 frame
+ *
+ *        A frame is a header followed by any number of blocks, each made up of an lz4_block_header and block
+ *        contents. Blocks are compressed independently of each other. The frame ends with an lz4_block_header of
+ *        all zeros.
+ *
+ * @note frames are written in host byte order
+ */
+struct lz4_frame_header
+{
+  /// Identifies stream as an LZ4 frame
+  char magic[4];
+  /// Maximum number of uncompressed bytes per block
+  std::uint32_t block_size;
+};
+
+/**
+ * @brief Leading section of a block in an LZ4 frame
+ */
+struct lz4_block_header
+{
+  /// Number of bytes of block contents which follow, ORed with lz4_block_uncompressed_flag if not compressed
+  std::uint32_t stored_size;
+  /// Number of bytes after decompression
+  std::uint32_t raw_size;
+};
+
+}  // namespace tyl::serialization
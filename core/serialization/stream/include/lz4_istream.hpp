@@ -0,0 +1,166 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file lz4_istream.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+// Tyl
+#include <tyl/serialization/istream.hpp>
+#include <tyl/serialization/lz4.hpp>
+#include <tyl/serialization/lz4_frame.hpp>
+
+namespace tyl::serialization
+{
+
+/**
+ * @brief Input stream adaptor which decompresses bytes read from another stream, written by lz4_ostream
+ *
+ *        Blocks are decoded one at a time, as they are needed.
+ */
+template <typename IStreamT> class lz4_istream final : public istream<lz4_istream<IStreamT>>
+{
+  friend class istream<lz4_istream<IStreamT>>;
+
+public:
+  explicit lz4_istream(istream<IStreamT>& is) : is_{static_cast<IStreamT*>(std::addressof(is))}
+  {
+    lz4_frame_header header;
+    if (
+      is_->read(&header, sizeof(header)) != sizeof(header) or
+      std::memcmp(header.magic, lz4_frame_magic, sizeof(lz4_frame_magic)) != 0 or
+      header.block_size > lz4_frame_max_block_size)
+    {
+      throw std::runtime_error{"Stream is not an LZ4 frame"};
+    }
+    block_size_ = header.block_size;
+    lz4_istream::next_block();
+  }
+
+private:
+  /**
+   * @copydoc istream<lz4_istream>::read
+   */
+  std::size_t read_impl(void* ptr, std::size_t len)
+  {
+    auto* bytes = static_cast<std::uint8_t*>(ptr);
+    std::size_t total = 0;
+    while (len > 0 and pos_ < raw_.size())
+    {
+      const std::size_t n = std::min(len, raw_.size() - pos_);
+      std::memcpy(bytes, raw_.data() + pos_, n);
+      bytes += n;
+      len -= n;
+      total += n;
+      pos_ += n;
+
+      if (pos_ == raw_.size())
+      {
+        lz4_istream::next_block();
+      }
+    }
+    return total;
+  }
+
+  /**
+   * @copydoc istream<lz4_istream>::peek
+   *
+   * @note returns EOF at the end of the frame
+   */
+  char peek_impl()
+  {
+    if (pos_ == raw_.size())
+    {
+      lz4_istream::next_block();
+    }
+    return (pos_ < raw_.size()) ? static_cast<char>(raw_[pos_]) : static_cast<char>(EOF);
+  }
+
+  /**
+   * @copydoc istream<lz4_istream>::available
+   *
+   * @note returns bytes remaining in the currently decoded block, which is zero only at the end of the frame
+   */
+  std::size_t available_impl() const { return raw_.size() - pos_; }
+
+  /**
+   * @brief Decodes the next block; leaves no bytes available only at the end of the frame
+   */
+  void next_block()
+  {
+    raw_.clear();
+    pos_ = 0;
+
+    if (end_of_frame_)
+    {
+      return;
+    }
+
+    lz4_block_header header;
+    if (is_->read(&header, sizeof(header)) != sizeof(header))
+    {
+      throw std::runtime_error{"LZ4 frame is truncated"};
+    }
+    else if (header.stored_size == 0)
+    {
+      end_of_frame_ = true;
+      return;
+    }
+
+    const bool uncompressed = (header.stored_size & lz4_block_uncompressed_flag) != 0;
+    const std::size_t stored_size = header.stored_size & ~lz4_block_uncompressed_flag;
+    if (header.raw_size == 0 or header.raw_size > block_size_ or stored_size > lz4_compress_bound(block_size_))
+    {
+      throw std::runtime_error{"LZ4 frame has an invalid block"};
+    }
+
+    raw_.resize(header.raw_size);
+    if (uncompressed)
+    {
+      if (stored_size != header.raw_size or is_->read(raw_.data(), stored_size) != stored_size)
+      {
+        throw std::runtime_error{"LZ4 frame has an invalid block"};
+      }
+      return;
+    }
+
+    compressed_.resize(stored_size);
+    if (
+      is_->read(compressed_.data(), stored_size) != stored_size or
+      !lz4_decompress(compressed_.data(), stored_size, raw_.data(), raw_.size()))
+    {
+      throw std::runtime_error{"LZ4 frame has an invalid block"};
+    }
+  }
+
+  /// Stream from which compressed bytes are read
+  IStreamT* is_;
+
+  /// Maximum number of uncompressed bytes per block
+  std::size_t block_size_ = 0;
+
+  /// Set once the end of the frame has been read
+  bool end_of_frame_ = false;
+
+  /// Current decoded block
+  std::vector<std::uint8_t> raw_;
+
+  /// Read position within raw_
+  std::size_t pos_ = 0;
+
+  /// Current block, as read from the stream
+  std::vector<std::uint8_t> compressed_;
+};
+
+template <typename IStreamT> lz4_istream(istream<IStreamT>& is) -> lz4_istream<IStreamT>;
+
+}  // namespace tyl::serialization
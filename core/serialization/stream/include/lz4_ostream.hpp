@@ -0,0 +1,177 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file lz4_ostream.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+// Tyl
+#include <tyl/async/job_system.hpp>
+#include <tyl/serialization/lz4.hpp>
+#include <tyl/serialization/lz4_frame.hpp>
+#include <tyl/serialization/ostream.hpp>
+
+namespace tyl::serialization
+{
+
+/**
+ * @brief Output stream adaptor which LZ4-compresses bytes written to another stream
+ *
+ *        Bytes are split into blocks which are compressed independently, so that blocks can be compressed in parallel
+ *        and decoded one at a time. See lz4_frame.hpp for the output format.
+ */
+template <typename OStreamT> class lz4_ostream final : public ostream<lz4_ostream<OStreamT>>
+{
+  friend class ostream<lz4_ostream<OStreamT>>;
+
+public:
+  explicit lz4_ostream(ostream<OStreamT>& os, const lz4_stream_options& options = {}) :
+      os_{static_cast<OStreamT*>(std::addressof(os))},
+      block_size_{std::clamp<std::size_t>(options.block_size, 1, lz4_frame_max_block_size)},
+      jobs_{options.jobs},
+      blocks_(std::max<std::size_t>(options.concurrency, 1))
+  {
+    lz4_frame_header header;
+    std::memcpy(header.magic, lz4_frame_magic, sizeof(lz4_frame_magic));
+    header.block_size = static_cast<std::uint32_t>(block_size_);
+    os_->write(&header, sizeof(header));
+
+    for (auto& block : blocks_)
+    {
+      block.raw.reserve(block_size_);
+    }
+  }
+
+  ~lz4_ostream()
+  {
+    lz4_ostream::flush_blocks();
+    const lz4_block_header end_mark{0, 0};
+    os_->write(&end_mark, sizeof(end_mark));
+  }
+
+private:
+  /**
+   * @copydoc ostream<lz4_ostream>::write
+   */
+  std::size_t write_impl(const void* ptr, const std::size_t len)
+  {
+    const auto* bytes = static_cast<const std::uint8_t*>(ptr);
+    for (std::size_t remaining = len; remaining > 0;)
+    {
+      auto& raw = blocks_[filled_].raw;
+      const std::size_t n = std::min(remaining, block_size_ - raw.size());
+      raw.insert(raw.end(), bytes, bytes + n);
+      bytes += n;
+      remaining -= n;
+
+      if (raw.size() == block_size_ and ++filled_ == blocks_.size())
+      {
+        lz4_ostream::flush_blocks();
+      }
+    }
+    return len;
+  }
+
+  /**
+   * @copydoc ostream<lz4_ostream>::flush
+   */
+  void flush_impl()
+  {
+    lz4_ostream::flush_blocks();
+    os_->flush();
+  }
+
+  struct block
+  {
+    /// Uncompressed block contents
+    std::vector<std::uint8_t> raw;
+    /// Compressed block contents
+    std::vector<std::uint8_t> compressed;
+    /// Size of compressed block, or 0 if block does not compress
+    std::size_t compressed_size = 0;
+  };
+
+  static void compress(block& b)
+  {
+    b.compressed.resize(lz4_compress_bound(b.raw.size()));
+    // Blocks which would not get smaller are stored uncompressed
+    b.compressed_size = lz4_compress(b.raw.data(), b.raw.size(), b.compressed.data(), b.raw.size() - 1);
+  }
+
+  /**
+   * @brief Compresses all filled blocks, and the partially filled block, and writes them in order
+   */
+  void flush_blocks()
+  {
+    const std::size_t count = (filled_ < blocks_.size() and !blocks_[filled_].raw.empty()) ? filled_ + 1 : filled_;
+    if (count == 0)
+    {
+      return;
+    }
+
+    if (jobs_ == nullptr)
+    {
+      std::for_each(blocks_.begin(), blocks_.begin() + count, &lz4_ostream::compress);
+    }
+    else
+    {
+      // Compress blocks concurrently, using the calling thread for the first
+      async::TaskGroup group{*jobs_};
+      for (std::size_t i = 1; i < count; ++i)
+      {
+        group.run([&b = blocks_[i]] { lz4_ostream::compress(b); });
+      }
+      lz4_ostream::compress(blocks_.front());
+      group.wait();
+    }
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      auto& b = blocks_[i];
+      const std::uint32_t raw_size = static_cast<std::uint32_t>(b.raw.size());
+      if (b.compressed_size == 0)
+      {
+        const lz4_block_header header{raw_size | lz4_block_uncompressed_flag, raw_size};
+        os_->write(&header, sizeof(header));
+        os_->write(b.raw.data(), b.raw.size());
+      }
+      else
+      {
+        const lz4_block_header header{static_cast<std::uint32_t>(b.compressed_size), raw_size};
+        os_->write(&header, sizeof(header));
+        os_->write(b.compressed.data(), b.compressed_size);
+      }
+      b.raw.clear();
+    }
+    filled_ = 0;
+  }
+
+  /// Stream to which compressed bytes are written
+  OStreamT* os_;
+
+  /// Maximum number of uncompressed bytes per block
+  std::size_t block_size_;
+
+  /// Job system on which blocks are compressed, or null to compress on the writing thread
+  async::JobSystem* jobs_;
+
+  /// Blocks to be compressed together; one per concurrent compression
+  std::vector<block> blocks_;
+
+  /// Number of completely filled blocks
+  std::size_t filled_ = 0;
+};
+
+template <typename OStreamT> lz4_ostream(ostream<OStreamT>& os) -> lz4_ostream<OStreamT>;
+
+template <typename OStreamT>
+lz4_ostream(ostream<OStreamT>& os, const lz4_stream_options& options) -> lz4_ostream<OStreamT>;
+
+}  // namespace tyl::serialization
@@ -0,0 +1,10 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file lz4_stream.hpp
+ */
+#pragma once
+
+// Tyl
+#include <tyl/serialization/lz4_istream.hpp>
+#include <tyl/serialization/lz4_ostream.hpp>
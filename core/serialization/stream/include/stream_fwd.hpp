@@ -14,5 +14,6 @@ class file_handle_ostream;
 class file_handle_istream;
 class file_ostream;
 class file_istream;
+class async_file_ostream;
 
 }  // namespace tyl::serialization
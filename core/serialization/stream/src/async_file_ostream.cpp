@@ -0,0 +1,317 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file async_file_ostream.cpp
+ */
+
+// C++ Standard Library
+#include <cerrno>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
+// Tyl
+#include <tyl/serialization/async_file_ostream.hpp>
+
+// Linux
+#include <fcntl.h>
+#include <stdio.h>
+#include <unistd.h>
+
+namespace tyl::serialization
+{
+
+/**
+ * @brief State shared between an async_file_ostream and its writer thread
+ */
+struct async_file_ostream::writer
+{
+  /**
+   * @brief Unit of work for the writer thread
+   */
+  struct command
+  {
+    /// Bytes to write; may be empty
+    std::vector<std::uint8_t> data;
+    /// Set once data, and everything before it, has been written
+    std::optional<std::promise<bool>> done;
+    /// If true, file is closed after data is written
+    bool close = false;
+  };
+
+  writer(const std::filesystem::path& path, const bool atomic) :
+      target_path{path}, write_path{atomic ? std::filesystem::path{path.string() + ".tmp"} : path}
+  {
+    fd = ::open(write_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0)
+    {
+      throw std::runtime_error{"failed to open file (" + write_path.string() + ") for write|binary"};
+    }
+  }
+
+  /**
+   * @brief Queues a command for the writer thread
+   */
+  void push(command&& cmd)
+  {
+    {
+      std::lock_guard lock{mutex};
+      if (!cmd.data.empty())
+      {
+        ++pending_buffers;
+      }
+      commands.push_back(std::move(cmd));
+    }
+    command_added.notify_one();
+  }
+
+  /**
+   * @brief Returns a buffer which has already been written, or an empty buffer if none are free
+   *
+   *        Waits until fewer than \c max_pending_buffers buffers are waiting to be written
+   */
+  std::vector<std::uint8_t> acquire(const std::size_t max_pending_buffers)
+  {
+    std::unique_lock lock{mutex};
+    buffer_written.wait(lock, [this, max_pending_buffers] { return pending_buffers < max_pending_buffers; });
+    if (free_buffers.empty())
+    {
+      return {};
+    }
+    auto buffer = std::move(free_buffers.back());
+    free_buffers.pop_back();
+    return buffer;
+  }
+
+  /**
+   * @brief Writes all of data to the file, retrying on partial writes
+   */
+  bool write_all(const std::vector<std::uint8_t>& data)
+  {
+    const std::uint8_t* p = data.data();
+    for (std::size_t remaining = data.size(); remaining > 0;)
+    {
+      const ssize_t n = ::write(fd, p, remaining);
+      if (n < 0)
+      {
+        if (errno == EINTR)
+        {
+          continue;
+        }
+        return false;
+      }
+      p += n;
+      remaining -= static_cast<std::size_t>(n);
+    }
+    return true;
+  }
+
+  /**
+   * @brief Syncs the directory containing the target path, so that a rename into it is durable
+   */
+  bool sync_directory() const
+  {
+    const auto directory = target_path.has_parent_path() ? target_path.parent_path() : std::filesystem::path{"."};
+    const int dir_fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (dir_fd < 0)
+    {
+      return false;
+    }
+    const bool synced = (::fsync(dir_fd) == 0);
+    return (::close(dir_fd) == 0) and synced;
+  }
+
+  /**
+   * @brief Syncs and closes the file; in atomic mode, moves it over the target path on success
+   */
+  bool finish(bool success)
+  {
+    success = (::fsync(fd) == 0) and success;
+    success = (::close(fd) == 0) and success;
+    if (target_path != write_path)
+    {
+      if (success)
+      {
+        success = (::rename(write_path.c_str(), target_path.c_str()) == 0) and sync_directory();
+      }
+      else
+      {
+        ::unlink(write_path.c_str());
+      }
+    }
+    return success;
+  }
+
+  /**
+   * @brief Writer thread body; runs until a close command is handled
+   */
+  void run()
+  {
+    bool success = true;
+    while (true)
+    {
+      command cmd;
+      {
+        std::unique_lock lock{mutex};
+        command_added.wait(lock, [this] { return !commands.empty(); });
+        cmd = std::move(commands.front());
+        commands.pop_front();
+      }
+
+      if (!cmd.data.empty())
+      {
+        success = write_all(cmd.data) and success;
+        cmd.data.clear();
+        {
+          std::lock_guard lock{mutex};
+          free_buffers.push_back(std::move(cmd.data));
+          --pending_buffers;
+        }
+        buffer_written.notify_one();
+      }
+
+      if (cmd.close)
+      {
+        success = finish(success);
+      }
+      else if (cmd.done)
+      {
+        success = (::fdatasync(fd) == 0) and success;
+      }
+
+      if (cmd.done)
+      {
+        cmd.done->set_value(success);
+      }
+
+      if (cmd.close)
+      {
+        return;
+      }
+    }
+  }
+
+  /// Path of file once closed
+  std::filesystem::path target_path;
+
+  /// Path of file being written
+  std::filesystem::path write_path;
+
+  /// Descriptor of file being written
+  int fd = -1;
+
+  /// Guards commands, free_buffers and pending_buffers
+  std::mutex mutex;
+
+  /// Signaled when a command is queued
+  std::condition_variable command_added;
+
+  /// Signaled when a buffer has been written
+  std::condition_variable buffer_written;
+
+  /// Number of buffers with data which have been queued, but not yet written
+  std::size_t pending_buffers = 0;
+
+  /// Commands waiting to be handled by the writer thread
+  std::deque<command> commands;
+
+  /// Written buffers, kept to be reused
+  std::vector<std::vector<std::uint8_t>> free_buffers;
+};
+
+namespace
+{
+
+std::future<bool> make_ready_future(const bool value)
+{
+  std::promise<bool> promise;
+  promise.set_value(value);
+  return promise.get_future();
+}
+
+}  // namespace
+
+async_file_ostream::async_file_ostream(const std::filesystem::path& path, const async_file_ostream_options& options) :
+    writer_{std::make_unique<writer>(path, options.atomic)},
+    writer_thread_{[w = writer_.get()] { w->run(); }},
+    buffer_size_{std::max<std::size_t>(options.buffer_size, 1)},
+    max_pending_buffers_{std::max<std::size_t>(options.max_pending_buffers, 1)}
+{
+  buffer_.reserve(buffer_size_);
+}
+
+async_file_ostream::async_file_ostream(async_file_ostream&& other) :
+    writer_{std::move(other.writer_)},
+    writer_thread_{std::move(other.writer_thread_)},
+    closed_{other.closed_},
+    buffer_size_{other.buffer_size_},
+    max_pending_buffers_{other.max_pending_buffers_},
+    buffer_{std::move(other.buffer_)}
+{}
+
+async_file_ostream::~async_file_ostream()
+{
+  if (writer_ == nullptr)
+  {
+    return;
+  }
+  else if (!closed_)
+  {
+    [[maybe_unused]] auto closed = async_file_ostream::close();
+  }
+  // Writer thread exits once it has handled the close command, after all pending writes
+  writer_thread_.join();
+}
+
+void async_file_ostream::submit()
+{
+  if (buffer_.empty())
+  {
+    return;
+  }
+  auto next = writer_->acquire(max_pending_buffers_);
+  next.reserve(buffer_size_);
+  writer_->push({std::move(buffer_), std::nullopt, false});
+  buffer_ = std::move(next);
+}
+
+std::future<bool> async_file_ostream::flush_async()
+{
+  if (closed_)
+  {
+    return make_ready_future(false);
+  }
+  std::promise<bool> done;
+  auto future = done.get_future();
+  if (buffer_.empty())
+  {
+    writer_->push({{}, std::move(done), false});
+    return future;
+  }
+  auto next = writer_->acquire(max_pending_buffers_);
+  next.reserve(buffer_size_);
+  writer_->push({std::move(buffer_), std::move(done), false});
+  buffer_ = std::move(next);
+  return future;
+}
+
+std::future<bool> async_file_ostream::close()
+{
+  if (closed_)
+  {
+    return make_ready_future(false);
+  }
+  std::promise<bool> done;
+  auto future = done.get_future();
+  writer_->push({std::move(buffer_), std::move(done), true});
+  buffer_.clear();
+  closed_ = true;
+  return future;
+}
+
+}  // namespace tyl::serialization
@@ -27,6 +27,12 @@ const char* flags_to_read_mode_str_human_readable(file_istream::flags fileopt)
 
 file_handle_istream::file_handle_istream(std::FILE* file_handle) : file_bytes_remaining_{0}, file_handle_{file_handle}
 {
+  // Handle is null when file_istream fails to open its file, which it reports after this constructor runs
+  if (file_handle_ == nullptr)
+  {
+    return;
+  }
+
   file_bytes_remaining_ = [file = file_handle_] {
     std::fseek(file, 0, SEEK_END);
     const auto size = std::ftell(file);
@@ -0,0 +1,238 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file lz4.cpp
+ */
+
+// C++ Standard Library
+#include <cstring>
+#include <vector>
+
+// Tyl
+#include <tyl/serialization/lz4.hpp>
+
+namespace tyl::serialization
+{
+namespace
+{
+
+/// Minimum length of a match
+constexpr std::size_t kMinMatch = 4;
+
+/// Number of bytes at the end of a block which are always literals
+constexpr std::size_t kLastLiterals = 5;
+
+/// Matches must start at least this many bytes before the end of a block
+constexpr std::size_t kMatchFindLimit = 12;
+
+/// Largest distance back to the start of a match
+constexpr std::size_t kMaxOffset = 65535;
+
+/// Number of bits used to index the match-finding hash table
+constexpr std::size_t kHashBits = 14;
+
+std::uint32_t read_u32(const std::uint8_t* p)
+{
+  std::uint32_t v;
+  std::memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+std::uint32_t hash(const std::uint32_t sequence) { return (sequence * 2654435761U) >> (32 - kHashBits); }
+
+/**
+ * @brief Writes the extended part of a literal or match length
+ */
+std::uint8_t* write_length(std::uint8_t* op, std::size_t len)
+{
+  for (; len >= 255; len -= 255)
+  {
+    *op++ = 255;
+  }
+  *op++ = static_cast<std::uint8_t>(len);
+  return op;
+}
+
+/**
+ * @brief Returns the number of bytes needed to write the extended part of a length
+ */
+constexpr std::size_t length_size(const std::size_t len) { return (len < 15) ? 0 : ((len - 15) / 255 + 1); }
+
+/**
+ * @brief Reads the extended part of a literal or match length
+ */
+bool read_length(const std::uint8_t*& ip, const std::uint8_t* const ip_end, std::size_t& len)
+{
+  std::uint8_t b;
+  do
+  {
+    if (ip == ip_end)
+    {
+      return false;
+    }
+    b = *ip++;
+    len += b;
+  } while (b == 255);
+  return true;
+}
+
+}  // namespace
+
+std::size_t lz4_compress(const void* src, const std::size_t len, void* dst, const std::size_t capacity)
+{
+  const auto* const base = static_cast<const std::uint8_t*>(src);
+  auto* op = static_cast<std::uint8_t*>(dst);
+  auto* const op_end = op + capacity;
+
+  std::size_t anchor = 0;
+
+  // Append a sequence made up of literals in [anchor, literals_end) and an optional match
+  const auto append = [&](const std::size_t literals_end, const std::size_t offset, const std::size_t match_len) {
+    const std::size_t literal_len = literals_end - anchor;
+    const std::size_t required = 1 + length_size(literal_len) + literal_len +
+      ((match_len == 0) ? 0 : (2 + length_size(match_len - kMinMatch)));
+    if (static_cast<std::size_t>(op_end - op) < required)
+    {
+      return false;
+    }
+
+    std::uint8_t* const token = op++;
+    *token = static_cast<std::uint8_t>(((literal_len < 15) ? literal_len : 15) << 4);
+    if (literal_len >= 15)
+    {
+      op = write_length(op, literal_len - 15);
+    }
+    std::memcpy(op, base + anchor, literal_len);
+    op += literal_len;
+
+    if (match_len != 0)
+    {
+      *op++ = static_cast<std::uint8_t>(offset);
+      *op++ = static_cast<std::uint8_t>(offset >> 8);
+      const std::size_t match_code = match_len - kMinMatch;
+      *token |= static_cast<std::uint8_t>((match_code < 15) ? match_code : 15);
+      if (match_code >= 15)
+      {
+        op = write_length(op, match_code - 15);
+      }
+    }
+    return true;
+  };
+
+  if (len > kMatchFindLimit)
+  {
+    std::vector<std::uint32_t> table(1UL << kHashBits, 0);
+
+    const std::size_t match_start_limit = len - kMatchFindLimit;
+    const std::size_t match_end_limit = len - kLastLiterals;
+
+    std::size_t ip = 0;
+    while (ip < match_start_limit)
+    {
+      const std::uint32_t sequence = read_u32(base + ip);
+      const std::uint32_t h = hash(sequence);
+      const std::size_t ref = table[h];
+      table[h] = static_cast<std::uint32_t>(ip);
+
+      if (ref >= ip or (ip - ref) > kMaxOffset or read_u32(base + ref) != sequence)
+      {
+        // Skip ahead faster through data which is not compressing
+        ip += 1 + ((ip - anchor) >> 6);
+        continue;
+      }
+
+      std::size_t match_len = kMinMatch;
+      while (ip + match_len < match_end_limit and base[ip + match_len] == base[ref + match_len])
+      {
+        ++match_len;
+      }
+
+      if (!append(ip, ip - ref, match_len))
+      {
+        return 0;
+      }
+      ip += match_len;
+      anchor = ip;
+    }
+  }
+
+  // Remaining bytes are written as literals
+  if (!append(len, 0, 0))
+  {
+    return 0;
+  }
+  return static_cast<std::size_t>(op - static_cast<std::uint8_t*>(dst));
+}
+
+bool lz4_decompress(const void* src, const std::size_t len, void* dst, const std::size_t raw_len)
+{
+  const auto* ip = static_cast<const std::uint8_t*>(src);
+  const auto* const ip_end = ip + len;
+  auto* const op_begin = static_cast<std::uint8_t*>(dst);
+  auto* op = op_begin;
+  auto* const op_end = op + raw_len;
+
+  while (ip != ip_end)
+  {
+    const std::uint8_t token = *ip++;
+
+    std::size_t literal_len = token >> 4;
+    if (literal_len == 15 and !read_length(ip, ip_end, literal_len))
+    {
+      return false;
+    }
+    if (static_cast<std::size_t>(ip_end - ip) < literal_len or static_cast<std::size_t>(op_end - op) < literal_len)
+    {
+      return false;
+    }
+    std::memcpy(op, ip, literal_len);
+    ip += literal_len;
+    op += literal_len;
+
+    // Last sequence has no match
+    if (ip == ip_end)
+    {
+      break;
+    }
+
+    if (ip_end - ip < 2)
+    {
+      return false;
+    }
+    const std::size_t offset = std::size_t{ip[0]} | (std::size_t{ip[1]} << 8);
+    ip += 2;
+    if (offset == 0 or offset > static_cast<std::size_t>(op - op_begin))
+    {
+      return false;
+    }
+
+    std::size_t match_len = token & 15;
+    if (match_len == 15 and !read_length(ip, ip_end, match_len))
+    {
+      return false;
+    }
+    match_len += kMinMatch;
+    if (static_cast<std::size_t>(op_end - op) < match_len)
+    {
+      return false;
+    }
+
+    const std::uint8_t* match = op - offset;
+    if (offset >= match_len)
+    {
+      std::memcpy(op, match, match_len);
+      op += match_len;
+    }
+    else
+    {
+      // Overlapping match repeats the last 'offset' bytes
+      for (std::size_t i = 0; i < match_len; ++i)
+      {
+        *op++ = *match++;
+      }
+    }
+  }
+  return op == op_end;
+}
+
+}  // namespace tyl::serialization
@@ -0,0 +1,139 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ */
+
+// C++ Standard Library
+#include <cstdint>
+#include <filesystem>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Tyl
+#include <tyl/serialization/async_file_ostream.hpp>
+#include <tyl/serialization/file_istream.hpp>
+
+using namespace tyl::serialization;
+
+namespace
+{
+
+std::vector<std::uint8_t> make_bytes(std::size_t len)
+{
+  std::vector<std::uint8_t> bytes(len);
+  std::iota(bytes.begin(), bytes.end(), 0);
+  return bytes;
+}
+
+std::vector<std::uint8_t> read_file(const char* filename)
+{
+  file_istream ifs{filename};
+  std::vector<std::uint8_t> bytes(ifs.available());
+  ifs.read(bytes.data(), bytes.size());
+  return bytes;
+}
+
+}  // namespace
+
+TEST(AsyncFileOutputStream, CannotOpenFile)
+{
+  ASSERT_THROW((async_file_ostream{"not-a-directory/async_file_stream.bin"}), std::runtime_error);
+}
+
+TEST(AsyncFileOutputStream, WriteAcrossBuffers)
+{
+  const auto bytes = make_bytes(1000);
+  {
+    async_file_ostream ofs{"async_file_stream.bin", {.buffer_size = 64}};
+    ofs.write(bytes.data(), bytes.size());
+    ASSERT_TRUE(ofs.flush_async().get());
+    ASSERT_TRUE(ofs.close().get());
+  }
+  ASSERT_EQ(read_file("async_file_stream.bin"), bytes);
+}
+
+TEST(AsyncFileOutputStream, WriteWithBoundedPendingBuffers)
+{
+  const auto bytes = make_bytes(1000);
+  for (const std::size_t max_pending_buffers : {1UL, 3UL})
+  {
+    {
+      async_file_ostream ofs{"async_file_stream.bin", {.buffer_size = 16, .max_pending_buffers = max_pending_buffers}};
+      for (std::size_t offset = 0; offset < bytes.size(); offset += 10)
+      {
+        ofs.write(bytes.data() + offset, 10);
+      }
+      ASSERT_TRUE(ofs.close().get());
+    }
+    ASSERT_EQ(read_file("async_file_stream.bin"), bytes);
+  }
+}
+
+TEST(AsyncFileOutputStream, AtomicRenameOnClose)
+{
+  std::filesystem::remove("async_file_stream.bin");
+
+  const auto bytes = make_bytes(100);
+  async_file_ostream ofs{"async_file_stream.bin"};
+  ofs.write(bytes.data(), bytes.size());
+  ASSERT_TRUE(ofs.flush_async().get());
+
+  // Target file does not exist until stream is closed
+  ASSERT_FALSE(std::filesystem::exists("async_file_stream.bin"));
+  ASSERT_TRUE(ofs.close().get());
+  ASSERT_TRUE(std::filesystem::exists("async_file_stream.bin"));
+  ASSERT_FALSE(std::filesystem::exists("async_file_stream.bin.tmp"));
+  ASSERT_EQ(read_file("async_file_stream.bin"), bytes);
+}
+
+TEST(AsyncFileOutputStream, NonAtomicWritesInPlace)
+{
+  const auto bytes = make_bytes(100);
+  async_file_ostream ofs{"async_file_stream.bin", {.atomic = false}};
+  ofs.write(bytes.data(), bytes.size());
+  ASSERT_TRUE(ofs.flush_async().get());
+  ASSERT_EQ(read_file("async_file_stream.bin"), bytes);
+  ASSERT_TRUE(ofs.close().get());
+}
+
+TEST(AsyncFileOutputStream, DestructorFinishesPendingWrites)
+{
+  std::filesystem::remove("async_file_stream.bin");
+
+  const auto bytes = make_bytes(1000);
+  {
+    async_file_ostream ofs{"async_file_stream.bin", {.buffer_size = 64}};
+    ofs.write(bytes.data(), bytes.size());
+  }
+  ASSERT_FALSE(std::filesystem::exists("async_file_stream.bin.tmp"));
+  ASSERT_EQ(read_file("async_file_stream.bin"), bytes);
+}
+
+TEST(AsyncFileOutputStream, MovedStreamFinishesPendingWrites)
+{
+  const auto bytes = make_bytes(100);
+  {
+    async_file_ostream ofs{"async_file_stream.bin"};
+    ofs.write(bytes.data(), bytes.size());
+    async_file_ostream moved{std::move(ofs)};
+  }
+  ASSERT_EQ(read_file("async_file_stream.bin"), bytes);
+}
+
+TEST(AsyncFileOutputStream, UseAfterClose)
+{
+  const auto bytes = make_bytes(100);
+  async_file_ostream ofs{"async_file_stream.bin"};
+  ofs.write(bytes.data(), bytes.size());
+  ASSERT_TRUE(ofs.close().get());
+
+  ASSERT_FALSE(ofs.close().get());
+  ASSERT_FALSE(ofs.flush_async().get());
+  ASSERT_NO_THROW(ofs.flush());
+  ASSERT_THROW(ofs.write(bytes.data(), bytes.size()), std::runtime_error);
+  ASSERT_EQ(read_file("async_file_stream.bin"), bytes);
+}
@@ -0,0 +1,169 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ */
+
+// C++ Standard Library
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Tyl
+#include <tyl/async/job_system.hpp>
+#include <tyl/serialization/lz4_istream.hpp>
+#include <tyl/serialization/lz4_ostream.hpp>
+#include <tyl/serialization/mem_istream.hpp>
+#include <tyl/serialization/mem_ostream.hpp>
+
+using namespace tyl::serialization;
+
+namespace
+{
+
+std::vector<std::uint8_t> make_repetitive(const std::size_t len)
+{
+  std::vector<std::uint8_t> data(len);
+  for (std::size_t i = 0; i < len; ++i)
+  {
+    data[i] = static_cast<std::uint8_t>((i / 7) % 13);
+  }
+  return data;
+}
+
+std::vector<std::uint8_t> make_random(const std::size_t len)
+{
+  std::mt19937 gen{0};
+  std::vector<std::uint8_t> data(len);
+  for (auto& b : data)
+  {
+    b = static_cast<std::uint8_t>(gen());
+  }
+  return data;
+}
+
+std::vector<std::uint8_t> round_trip(
+  const std::vector<std::uint8_t>& data,
+  const lz4_stream_options& options,
+  std::size_t* compressed_size = nullptr)
+{
+  mem_ostream oms;
+  {
+    lz4_ostream los{oms, options};
+    los.write(data.data(), data.size());
+  }
+
+  mem_istream ims{std::move(oms)};
+  if (compressed_size != nullptr)
+  {
+    *compressed_size = ims.available();
+  }
+
+  lz4_istream lis{ims};
+  std::vector<std::uint8_t> read_data(data.size());
+  EXPECT_EQ(lis.read(read_data.data(), read_data.size()), data.size());
+  EXPECT_EQ(lis.available(), 0UL);
+  return read_data;
+}
+
+}  // namespace
+
+TEST(LZ4Block, CompressDecompress)
+{
+  const auto data = make_repetitive(10000);
+  std::vector<std::uint8_t> compressed(lz4_compress_bound(data.size()));
+  const std::size_t compressed_size = lz4_compress(data.data(), data.size(), compressed.data(), compressed.size());
+  ASSERT_GT(compressed_size, 0UL);
+  ASSERT_LT(compressed_size, data.size() / 10);
+
+  std::vector<std::uint8_t> decompressed(data.size());
+  ASSERT_TRUE(lz4_decompress(compressed.data(), compressed_size, decompressed.data(), decompressed.size()));
+  ASSERT_EQ(data, decompressed);
+}
+
+TEST(LZ4Block, DecompressRejectsWrongSize)
+{
+  const auto data = make_repetitive(1000);
+  std::vector<std::uint8_t> compressed(lz4_compress_bound(data.size()));
+  const std::size_t compressed_size = lz4_compress(data.data(), data.size(), compressed.data(), compressed.size());
+
+  std::vector<std::uint8_t> decompressed(data.size() + 1);
+  ASSERT_FALSE(lz4_decompress(compressed.data(), compressed_size, decompressed.data(), decompressed.size()));
+}
+
+TEST(LZ4Stream, RoundTripRepetitive)
+{
+  const auto data = make_repetitive(1000000);
+  std::size_t compressed_size = 0;
+  ASSERT_EQ(round_trip(data, {}, &compressed_size), data);
+  ASSERT_LT(compressed_size, data.size() / 10);
+}
+
+TEST(LZ4Stream, RoundTripIncompressible)
+{
+  const auto data = make_random(100000);
+  ASSERT_EQ(round_trip(data, {}), data);
+}
+
+TEST(LZ4Stream, RoundTripBuffered)
+{
+  const auto data = make_repetitive(1000000);
+  ASSERT_EQ(round_trip(data, {4096, 4}), data);
+}
+
+TEST(LZ4Stream, RoundTripConcurrent)
+{
+  tyl::async::JobSystem jobs{tyl::async::JobSystemOptions{.worker_count = 3}};
+  const auto data = make_repetitive(1000000);
+  ASSERT_EQ(round_trip(data, {4096, 4, &jobs}), data);
+}
+
+TEST(LZ4Stream, RoundTripEmpty)
+{
+  const std::vector<std::uint8_t> data;
+  ASSERT_EQ(round_trip(data, {}), data);
+}
+
+TEST(LZ4Stream, PeekAcrossBlocks)
+{
+  const auto data = make_random(10);
+
+  mem_ostream oms;
+  {
+    lz4_ostream los{oms, {4}};
+    los.write(data.data(), data.size());
+  }
+
+  mem_istream ims{std::move(oms)};
+  lz4_istream lis{ims};
+  for (const auto expected : data)
+  {
+    ASSERT_EQ(lis.peek(), static_cast<char>(expected));
+    std::uint8_t actual;
+    ASSERT_EQ(lis.read(&actual, 1), 1UL);
+    ASSERT_EQ(actual, expected);
+  }
+  ASSERT_EQ(lis.peek(), static_cast<char>(EOF));
+}
+
+TEST(LZ4Stream, PeekEmpty)
+{
+  mem_ostream oms;
+  {
+    lz4_ostream los{oms};
+  }
+
+  mem_istream ims{std::move(oms)};
+  lz4_istream lis{ims};
+  ASSERT_EQ(lis.available(), 0UL);
+  ASSERT_EQ(lis.peek(), static_cast<char>(EOF));
+}
+
+TEST(LZ4Stream, RejectsInvalidFrame)
+{
+  mem_istream ims{std::vector<std::uint8_t>{'n', 'o', 'p', 'e', 0, 0, 0, 0}};
+  ASSERT_THROW((lz4_istream{ims}), std::runtime_error);
+}
@@ -0,0 +1,178 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file reflect.cpp
+ */
+
+// C++ Standard Library
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Tyl
+#include <tyl/serialization/binary_archive.hpp>
+#include <tyl/serialization/compact_binary_archive.hpp>
+#include <tyl/serialization/json_archive.hpp>
+#include <tyl/serialization/mem_istream.hpp>
+#include <tyl/serialization/mem_ostream.hpp>
+#include <tyl/serialization/reflect.hpp>
+#include <tyl/serialization/std/string.hpp>
+
+using namespace tyl::serialization;
+
+struct ReflectedStruct
+{
+  int x;
+  float y;
+  double z;
+  std::string name;
+  std::uint8_t flags;
+};
+
+struct ReflectedNestedStruct
+{
+  ReflectedStruct first;
+  ReflectedStruct second;
+};
+
+template <typename T> struct ReflectedTemplate
+{
+  T value;
+  int count;
+};
+
+namespace tyl::serialization
+{
+
+TYL_REFLECT(::ReflectedStruct, x, y, z, name, flags);
+
+TYL_REFLECT(::ReflectedNestedStruct, first, second);
+
+template <typename T> struct reflect<::ReflectedTemplate<T>>
+{
+  static constexpr auto fields = std::make_tuple(TYL_REFLECT_FIELDS(::ReflectedTemplate<T>, value, count));
+};
+
+template <typename ArchiveT, typename T>
+struct serialize<ArchiveT, ::ReflectedTemplate<T>> : serialize_reflected<ArchiveT, ::ReflectedTemplate<T>>
+{};
+
+}  // namespace tyl::serialization
+
+static bool operator==(const ReflectedStruct& lhs, const ReflectedStruct& rhs)
+{
+  return lhs.x == rhs.x and lhs.y == rhs.y and lhs.z == rhs.z and lhs.name == rhs.name and lhs.flags == rhs.flags;
+}
+
+TEST(Reflect, BinaryRoundTrip)
+{
+  const ReflectedNestedStruct target{{1, 2.f, 3.0, "first", 4}, {5, 6.f, 7.0, "second", 8}};
+
+  mem_ostream oms;
+  {
+    binary_oarchive oar{oms};
+    ASSERT_NO_THROW((oar << target));
+  }
+
+  mem_istream ims{std::move(oms)};
+  {
+    binary_iarchive iar{ims};
+    ReflectedNestedStruct read_value;
+    ASSERT_NO_THROW((iar >> read_value));
+    ASSERT_EQ(read_value.first, target.first);
+    ASSERT_EQ(read_value.second, target.second);
+  }
+}
+
+TEST(Reflect, BinaryCoalescedMatchesFieldWise)
+{
+  const ReflectedStruct target{1, 2.f, 3.0, "name", 4};
+
+  mem_ostream coalesced_oms;
+  {
+    binary_oarchive oar{coalesced_oms};
+    oar << target;
+  }
+
+  mem_ostream field_wise_oms;
+  {
+    binary_oarchive oar{field_wise_oms};
+    oar << target.x;
+    oar << target.y;
+    oar << target.z;
+    oar << target.name;
+    oar << target.flags;
+  }
+
+  mem_istream coalesced_ims{std::move(coalesced_oms)};
+  mem_istream field_wise_ims{std::move(field_wise_oms)};
+  ASSERT_EQ(coalesced_ims.available(), field_wise_ims.available());
+
+  std::vector<char> coalesced(coalesced_ims.available());
+  std::vector<char> field_wise(field_wise_ims.available());
+  coalesced_ims.read(coalesced.data(), coalesced.size());
+  field_wise_ims.read(field_wise.data(), field_wise.size());
+  ASSERT_EQ(coalesced, field_wise);
+}
+
+TEST(Reflect, CompactStoresIntegerFieldsAsVarints)
+{
+  const ReflectedStruct target{1, 2.f, 3.0, "name", 4};
+
+  mem_ostream reflected_oms;
+  {
+    compact_binary_oarchive oar{reflected_oms};
+    oar << target;
+  }
+
+  mem_ostream field_wise_oms;
+  {
+    compact_binary_oarchive oar{field_wise_oms};
+    oar << target.x;
+    oar << target.y;
+    oar << target.z;
+    oar << target.name;
+    oar << target.flags;
+  }
+
+  mem_istream reflected_ims{std::move(reflected_oms)};
+  mem_istream field_wise_ims{std::move(field_wise_oms)};
+  ASSERT_EQ(reflected_ims.available(), field_wise_ims.available());
+
+  std::vector<std::uint8_t> reflected(reflected_ims.available());
+  std::vector<std::uint8_t> field_wise(field_wise_ims.available());
+  reflected_ims.read(reflected.data(), reflected.size());
+  field_wise_ims.read(field_wise.data(), field_wise.size());
+  ASSERT_EQ(reflected, field_wise);
+
+  mem_istream ims{std::move(reflected)};
+  {
+    compact_binary_iarchive iar{ims};
+    ReflectedStruct read_value;
+    ASSERT_NO_THROW((iar >> read_value));
+    ASSERT_EQ(read_value, target);
+  }
+}
+
+TEST(Reflect, JSONRoundTrip)
+{
+  const ReflectedTemplate<ReflectedStruct> target{{1, 2.f, 3.0, "value", 4}, 9};
+
+  mem_ostream oms;
+  {
+    json_oarchive oar{oms};
+    ASSERT_NO_THROW((oar << named{"target", target}));
+  }
+
+  mem_istream ims{std::move(oms)};
+  {
+    json_iarchive iar{ims};
+    ReflectedTemplate<ReflectedStruct> read_value;
+    ASSERT_NO_THROW((iar >> named{"target", read_value}));
+    ASSERT_EQ(read_value.value, target.value);
+    ASSERT_EQ(read_value.count, target.count);
+  }
+}
@@ -0,0 +1,472 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file serialization_benchmark.cpp
+ *
+ * Round-trips a synthetic scene through each archive and stream combination and prints results as JSON
+ *
+ * Usage: serialization_benchmark [object_count] [vertices_per_object] [iterations]
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+// Tyl
+#include <tyl/serialization/binary_archive.hpp>
+#include <tyl/serialization/compact_binary_archive.hpp>
+#include <tyl/serialization/file_istream.hpp>
+#include <tyl/serialization/file_ostream.hpp>
+#include <tyl/serialization/json_archive.hpp>
+#include <tyl/serialization/lz4_stream.hpp>
+#include <tyl/serialization/mem_istream.hpp>
+#include <tyl/serialization/mem_ostream.hpp>
+#include <tyl/serialization/named.hpp>
+#include <tyl/serialization/reflect.hpp>
+#include <tyl/serialization/std/string.hpp>
+#include <tyl/serialization/std/vector.hpp>
+
+namespace
+{
+
+/// Number of heap allocations made so far
+std::atomic<std::size_t> allocation_count{0};
+
+/// Number of heap-allocated bytes so far
+std::atomic<std::size_t> allocated_bytes{0};
+
+/**
+ * @brief Counts and makes a heap allocation; alignment of zero uses malloc's default alignment
+ */
+void* counted_allocate(const std::size_t size, const std::size_t alignment)
+{
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+  const std::size_t padded_size = std::max<std::size_t>(size, 1);
+  void* const ptr = (alignment == 0)
+    ? std::malloc(padded_size)
+    : std::aligned_alloc(alignment, (padded_size + alignment - 1) / alignment * alignment);
+  if (ptr == nullptr)
+  {
+    throw std::bad_alloc{};
+  }
+  return ptr;
+}
+
+}  // namespace
+
+// Counting allocator hooks; every replaceable form is defined, so that all allocations are counted and each
+// allocation form is paired with its own deallocation form
+
+void* operator new(std::size_t size) { return counted_allocate(size, 0); }
+
+void* operator new[](std::size_t size) { return counted_allocate(size, 0); }
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+  return counted_allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+  return counted_allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, [[maybe_unused]] std::size_t size) noexcept { std::free(ptr); }
+
+void operator delete[](void* ptr, [[maybe_unused]] std::size_t size) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, [[maybe_unused]] std::align_val_t alignment) noexcept { std::free(ptr); }
+
+void operator delete[](void* ptr, [[maybe_unused]] std::align_val_t alignment) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, [[maybe_unused]] std::size_t size, [[maybe_unused]] std::align_val_t alignment) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](
+  void* ptr,
+  [[maybe_unused]] std::size_t size,
+  [[maybe_unused]] std::align_val_t alignment) noexcept
+{
+  std::free(ptr);
+}
+
+struct Transform
+{
+  float x;
+  float y;
+  float z;
+  float rotation;
+  float scale;
+};
+
+struct SceneObject
+{
+  std::string name;
+  Transform transform;
+  std::int32_t layer;
+  std::vector<float> vertices;
+  std::vector<std::uint32_t> children;
+};
+
+struct Scene
+{
+  std::vector<SceneObject> objects;
+};
+
+bool operator==(const Transform& lhs, const Transform& rhs)
+{
+  return lhs.x == rhs.x and lhs.y == rhs.y and lhs.z == rhs.z and lhs.rotation == rhs.rotation and
+    lhs.scale == rhs.scale;
+}
+
+bool operator==(const SceneObject& lhs, const SceneObject& rhs)
+{
+  return lhs.name == rhs.name and lhs.transform == rhs.transform and lhs.layer == rhs.layer and
+    lhs.vertices == rhs.vertices and lhs.children == rhs.children;
+}
+
+namespace tyl::serialization
+{
+
+TYL_REFLECT(::Transform, x, y, z, rotation, scale);
+
+TYL_REFLECT(::SceneObject, name, transform, layer, vertices, children);
+
+TYL_REFLECT(::Scene, objects);
+
+}  // namespace tyl::serialization
+
+using namespace tyl::serialization;
+
+namespace
+{
+
+/**
+ * @brief Output stream adaptor which counts calls made to another stream
+ */
+template <typename OStreamT> class counting_ostream final : public ostream<counting_ostream<OStreamT>>
+{
+  friend class ostream<counting_ostream<OStreamT>>;
+
+public:
+  counting_ostream(OStreamT& os, std::size_t& calls) : os_{std::addressof(os)}, calls_{std::addressof(calls)} {}
+
+private:
+  std::size_t write_impl(const void* ptr, std::size_t len)
+  {
+    ++(*calls_);
+    return os_->write(ptr, len);
+  }
+
+  void flush_impl()
+  {
+    ++(*calls_);
+    os_->flush();
+  }
+
+  OStreamT* os_;
+  std::size_t* calls_;
+};
+
+/**
+ * @brief Input stream adaptor which counts calls made to another stream
+ */
+template <typename IStreamT> class counting_istream final : public istream<counting_istream<IStreamT>>
+{
+  friend class istream<counting_istream<IStreamT>>;
+
+public:
+  counting_istream(IStreamT& is, std::size_t& calls) : is_{std::addressof(is)}, calls_{std::addressof(calls)} {}
+
+private:
+  std::size_t read_impl(void* ptr, std::size_t len)
+  {
+    ++(*calls_);
+    return is_->read(ptr, len);
+  }
+
+  decltype(auto) peek_impl()
+  {
+    ++(*calls_);
+    return is_->peek();
+  }
+
+  std::size_t available_impl() const
+  {
+    ++(*calls_);
+    return is_->available();
+  }
+
+  IStreamT* is_;
+  std::size_t* calls_;
+};
+
+/**
+ * @brief Stream calls, heap allocations and time spent on one save or load
+ */
+struct Measurement
+{
+  double seconds = 0;
+  std::size_t stream_calls = 0;
+  std::size_t allocations = 0;
+  std::size_t allocated_bytes = 0;
+
+  Measurement& operator+=(const Measurement& other)
+  {
+    seconds += other.seconds;
+    stream_calls += other.stream_calls;
+    allocations += other.allocations;
+    allocated_bytes += other.allocated_bytes;
+    return *this;
+  }
+};
+
+/**
+ * @brief Runs body and measures it; body is passed a counter to increment on every stream call
+ */
+template <typename BodyT> Measurement measure(BodyT body)
+{
+  Measurement m;
+  const std::size_t allocation_count_start = allocation_count.load();
+  const std::size_t allocated_bytes_start = allocated_bytes.load();
+  const auto t_start = std::chrono::steady_clock::now();
+  body(m.stream_calls);
+  m.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t_start).count();
+  m.allocations = allocation_count.load() - allocation_count_start;
+  m.allocated_bytes = allocated_bytes.load() - allocated_bytes_start;
+  return m;
+}
+
+/**
+ * @brief Archive types under test
+ */
+struct BinaryArchives
+{
+  static constexpr const char* name = "binary";
+  template <typename OStreamT> static auto output(ostream<OStreamT>& os) { return binary_oarchive<OStreamT>{os}; }
+  template <typename IStreamT> static auto input(istream<IStreamT>& is) { return binary_iarchive<IStreamT>{is}; }
+};
+
+struct CompactBinaryArchives
+{
+  static constexpr const char* name = "compact_binary";
+  template <typename OStreamT> static auto output(ostream<OStreamT>& os)
+  {
+    return compact_binary_oarchive<OStreamT>{os};
+  }
+  template <typename IStreamT> static auto input(istream<IStreamT>& is)
+  {
+    return compact_binary_iarchive<IStreamT>{is};
+  }
+};
+
+template <json_packet_format PacketFormat> struct JSONArchives
+{
+  static constexpr const char* name = (PacketFormat == json_packet_format::base64) ? "json_base64" : "json";
+  template <typename OStreamT> static auto output(ostream<OStreamT>& os)
+  {
+    return json_oarchive<OStreamT, PacketFormat>{os};
+  }
+  template <typename IStreamT> static auto input(istream<IStreamT>& is)
+  {
+    return json_iarchive<IStreamT, PacketFormat>{is};
+  }
+};
+
+/**
+ * @brief Stream types under test; each saves, then loads, and reports the number of serialized bytes
+ */
+struct MemStreams
+{
+  static constexpr const char* name = "mem";
+
+  template <typename SaveT, typename LoadT>
+  static std::size_t round_trip(SaveT save, LoadT load, Measurement& saving, Measurement& loading)
+  {
+    mem_ostream oms;
+    saving += measure([&](std::size_t& calls) {
+      counting_ostream os{oms, calls};
+      save(os);
+    });
+    mem_istream ims{std::move(oms)};
+    const std::size_t size = ims.available();
+    loading += measure([&](std::size_t& calls) {
+      counting_istream is{ims, calls};
+      load(is);
+    });
+    return size;
+  }
+};
+
+struct FileStreams
+{
+  static constexpr const char* name = "file";
+
+  template <typename SaveT, typename LoadT>
+  static std::size_t round_trip(SaveT save, LoadT load, Measurement& saving, Measurement& loading)
+  {
+    const auto path = std::filesystem::temp_directory_path() / "tyl_serialization_benchmark.bin";
+    saving += measure([&](std::size_t& calls) {
+      file_ostream ofs{path};
+      counting_ostream os{static_cast<file_handle_ostream&>(ofs), calls};
+      save(os);
+    });
+    const std::size_t size = std::filesystem::file_size(path);
+    loading += measure([&](std::size_t& calls) {
+      file_istream ifs{path};
+      counting_istream is{static_cast<file_handle_istream&>(ifs), calls};
+      load(is);
+    });
+    std::filesystem::remove(path);
+    return size;
+  }
+};
+
+struct LZ4MemStreams
+{
+  static constexpr const char* name = "lz4_mem";
+
+  template <typename SaveT, typename LoadT>
+  static std::size_t round_trip(SaveT save, LoadT load, Measurement& saving, Measurement& loading)
+  {
+    mem_ostream oms;
+    saving += measure([&](std::size_t& calls) {
+      lz4_ostream los{oms};
+      counting_ostream os{los, calls};
+      save(os);
+    });
+    mem_istream ims{std::move(oms)};
+    const std::size_t size = ims.available();
+    loading += measure([&](std::size_t& calls) {
+      lz4_istream lis{ims};
+      counting_istream is{lis, calls};
+      load(is);
+    });
+    return size;
+  }
+};
+
+Scene make_scene(const std::size_t object_count, const std::size_t vertices_per_object)
+{
+  std::mt19937 rng{0};
+  std::uniform_real_distribution<float> coordinate{-100.f, 100.f};
+  std::uniform_int_distribution<std::uint32_t> child{0, static_cast<std::uint32_t>(object_count)};
+
+  Scene scene;
+  scene.objects.resize(object_count);
+  for (std::size_t i = 0; i < object_count; ++i)
+  {
+    auto& object = scene.objects[i];
+    object.name = "object_" + std::to_string(i);
+    object.transform = Transform{coordinate(rng), coordinate(rng), coordinate(rng), coordinate(rng), 1.f};
+    object.layer = static_cast<std::int32_t>(i % 8);
+    object.vertices.resize(vertices_per_object);
+    for (auto& v : object.vertices)
+    {
+      v = coordinate(rng);
+    }
+    object.children.resize(i % 4);
+    for (auto& c : object.children)
+    {
+      c = child(rng);
+    }
+  }
+  return scene;
+}
+
+template <typename ArchivesT, typename StreamsT>
+void run(const Scene& scene, const std::size_t iterations, const bool last)
+{
+  Measurement saving;
+  Measurement loading;
+  std::size_t size = 0;
+  bool ok = true;
+
+  for (std::size_t i = 0; i < iterations; ++i)
+  {
+    Scene read_scene;
+    size = StreamsT::round_trip(
+      [&](auto& os) {
+        auto oar = ArchivesT::output(os);
+        oar << named{"scene", scene};
+      },
+      [&](auto& is) {
+        auto iar = ArchivesT::input(is);
+        iar >> named{"scene", read_scene};
+      },
+      saving,
+      loading);
+    ok = ok and (read_scene.objects == scene.objects);
+  }
+
+  const double n = static_cast<double>(iterations);
+  const double objects = n * static_cast<double>(scene.objects.size());
+  const auto print = [&](const char* label, const Measurement& m, const char* trailing) {
+    std::printf(
+      "      \"%s\": {\"seconds\": %.6f, \"bytes_per_second\": %.1f, \"stream_calls_per_object\": %.3f, "
+      "\"allocations_per_object\": %.3f, \"allocated_bytes_per_object\": %.1f}%s\n",
+      label,
+      m.seconds / n,
+      static_cast<double>(size) * n / m.seconds,
+      static_cast<double>(m.stream_calls) / objects,
+      static_cast<double>(m.allocations) / objects,
+      static_cast<double>(m.allocated_bytes) / objects,
+      trailing);
+  };
+
+  std::printf("    {\n");
+  std::printf("      \"archive\": \"%s\",\n", ArchivesT::name);
+  std::printf("      \"stream\": \"%s\",\n", StreamsT::name);
+  std::printf("      \"serialized_bytes\": %zu,\n", size);
+  std::printf("      \"round_trip_ok\": %s,\n", ok ? "true" : "false");
+  print("save", saving, ",");
+  print("load", loading, "");
+  std::printf("    }%s\n", last ? "" : ",");
+}
+
+template <typename ArchivesT> void run_all_streams(const Scene& scene, const std::size_t iterations, const bool last)
+{
+  run<ArchivesT, MemStreams>(scene, iterations, false);
+  run<ArchivesT, FileStreams>(scene, iterations, false);
+  run<ArchivesT, LZ4MemStreams>(scene, iterations, last);
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  const std::size_t object_count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 10'000;
+  const std::size_t vertices_per_object = (argc > 2) ? std::strtoull(argv[2], nullptr, 10) : 64;
+  const std::size_t iterations = (argc > 3) ? std::max<std::size_t>(std::strtoull(argv[3], nullptr, 10), 1) : 5;
+
+  const auto scene = make_scene(object_count, vertices_per_object);
+
+  std::printf("{\n");
+  std::printf("  \"object_count\": %zu,\n", object_count);
+  std::printf("  \"vertices_per_object\": %zu,\n", vertices_per_object);
+  std::printf("  \"iterations\": %zu,\n", iterations);
+  std::printf("  \"results\": [\n");
+  run_all_streams<BinaryArchives>(scene, iterations, false);
+  run_all_streams<CompactBinaryArchives>(scene, iterations, false);
+  run_all_streams<JSONArchives<json_packet_format::sequence>>(scene, iterations, false);
+  run_all_streams<JSONArchives<json_packet_format::base64>>(scene, iterations, true);
+  std::printf("  ]\n");
+  std::printf("}\n");
+  return 0;
+}
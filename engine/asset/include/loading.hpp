@@ -39,7 +39,8 @@ struct LoadStatus
 /**
  * @brief Loads any unloaded assets
  *
- * Loads are dispatched to one or more threads
+ * Loads are dispatched to one or more threads. Loaded assets are added to the collection as
+ * Resources::main_thread_queue is drained, which must happen on the thread which owns the graphics and audio devices.
  */
 LoadStatus Load(Collection& collection, Resources& resources);
 
@@ -0,0 +1,171 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file pack.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+// Tyl
+#include <tyl/expected.hpp>
+
+namespace tyl::engine::asset
+{
+
+/**
+ * @brief Error code indicating problems with pack creation or access
+ */
+enum class PackError
+{
+  kFailedToOpen,
+  kFailedToMap,
+  kInvalidFormat,
+  kFailedToRead,
+  kFailedToWrite,
+  kPathCollision,
+};
+
+/**
+ * @brief Code indicating how an asset payload is stored within a pack
+ */
+enum class PackCodec : std::uint32_t
+{
+  kRaw,
+};
+
+/**
+ * @brief Leading section of a pack file
+ */
+struct PackHeader
+{
+  /// Identifies file as a pack
+  char magic[4];
+  /// Pack format version
+  std::uint32_t version;
+  /// Number of PackEntry records which immediately follow this header
+  std::uint64_t entry_count;
+};
+
+/**
+ * @brief Table-of-contents record for a single asset in a pack
+ *
+ * @note entries are sorted by path_hash; entries with equal hashes are told apart by their paths
+ */
+struct PackEntry
+{
+  /// Hash of the asset path, relative to the root directory from which the pack was created
+  std::uint64_t path_hash;
+  /// Offset of asset path (in normalized, generic form, without a terminating null) from start of the pack file
+  std::uint64_t path_offset;
+  /// Offset of asset payload from start of the pack file, in bytes
+  std::uint64_t offset;
+  /// Size of asset payload, in bytes
+  std::uint64_t size;
+  /// Length of asset path, in bytes
+  std::uint32_t path_size;
+  /// Asset payload encoding
+  PackCodec codec;
+};
+
+/**
+ * @brief View of an asset payload within a mapped pack
+ */
+struct PackData
+{
+  /// Start of payload
+  const void* data;
+  /// Size of payload, in bytes
+  std::size_t size;
+  /// Payload encoding
+  PackCodec codec;
+};
+
+/**
+ * @brief Returns the hash used to look up an asset path in a pack
+ */
+std::uint64_t PackPathHash(const std::filesystem::path& path);
+
+/**
+ * @brief Read-only archive of many assets, mapped into memory as a single file
+ *
+ *        A pack is made up of a PackHeader, a table of PackEntry records sorted by path hash, a table of asset paths,
+ *        and concatenated asset payloads. Assets in a pack are resolved without any per-asset file system access.
+ *
+ * @note pack files are written in host byte order
+ */
+class Pack
+{
+public:
+  Pack(Pack&& other);
+
+  ~Pack();
+
+  /**
+   * @brief Looks up an asset by its path, relative to the root directory from which the pack was created
+   *
+   * @return payload view, valid for the lifetime of this pack; or std::nullopt if asset is not in this pack
+   */
+  std::optional<PackData> find(const std::filesystem::path& path) const;
+
+  /**
+   * @brief Returns number of assets in this pack
+   */
+  std::size_t size() const { return entry_count_; }
+
+  /**
+   * @brief Returns path of the mapped pack file
+   */
+  const std::filesystem::path& path() const { return path_; }
+
+  /**
+   * @brief Returns last modification time of the mapped pack file
+   */
+  std::filesystem::file_time_type last_write_time() const { return last_write_time_; }
+
+  /**
+   * @brief Maps a pack file into memory
+   */
+  [[nodiscard]] static expected<Pack, PackError> open(const std::filesystem::path& path);
+
+  /**
+   * @brief Writes a pack file containing the given asset files
+   *
+   * @param pack_path  path of pack file to write
+   * @param root  directory from which asset paths in the pack are made relative
+   * @param files  asset files to add to the pack
+   *
+   * @return number of assets written
+   */
+  [[nodiscard]] static expected<std::size_t, PackError> write(
+    const std::filesystem::path& pack_path,
+    const std::filesystem::path& root,
+    const std::vector<std::filesystem::path>& files);
+
+private:
+  Pack(
+    const std::filesystem::path& path,
+    std::filesystem::file_time_type last_write_time,
+    void* mapped,
+    std::size_t mapped_size);
+
+  /// Path of the mapped pack file
+  std::filesystem::path path_;
+  /// Last modification time of the mapped pack file
+  std::filesystem::file_time_type last_write_time_;
+  /// Start of the mapped pack file
+  void* mapped_;
+  /// Size of the mapped pack file, in bytes
+  std::size_t mapped_size_;
+  /// Start of table of contents (within mapped region)
+  const PackEntry* entries_;
+  /// Number of table of contents entries
+  std::size_t entry_count_;
+};
+
+}  // namespace tyl::engine::asset
@@ -0,0 +1,111 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file residency.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+
+// Tyl
+#include <tyl/engine/asset/types.hpp>
+#include <tyl/engine/common/clock.hpp>
+#include <tyl/engine/common/resources_fwd.hpp>
+#include <tyl/engine/ecs/types.hpp>
+
+namespace tyl::engine::asset
+{
+
+/**
+ * @brief Memory budgets used to decide when loaded assets should be evicted
+ */
+struct ResidencyOptions
+{
+  /// Maximum total size of resident assets, as loaded from their source files
+  std::uintmax_t host_budget_in_bytes = std::numeric_limits<std::uintmax_t>::max();
+
+  /// Maximum total size of resident assets on device
+  std::uintmax_t device_budget_in_bytes = std::numeric_limits<std::uintmax_t>::max();
+
+  /// Assets which have been used more recently than this are never evicted
+  Clock::Duration min_unused_duration = Clock::seconds(1);
+};
+
+/**
+ * @brief Summary of resident assets after eviction
+ */
+struct ResidencyStatus
+{
+  /// Total size of resident assets, as loaded from their source files
+  std::uintmax_t host_size_in_bytes = 0;
+
+  /// Total size of resident assets on device
+  std::uintmax_t device_size_in_bytes = 0;
+
+  /// Number of assets evicted
+  std::size_t evicted = 0;
+
+  /// Returns true if resident assets are within the budgets given by options
+  constexpr bool within(const ResidencyOptions& options) const
+  {
+    return (host_size_in_bytes <= options.host_budget_in_bytes) and
+      (device_size_in_bytes <= options.device_budget_in_bytes);
+  }
+};
+
+/**
+ * @brief Evicts least-recently used assets until resident assets are within budget
+ *
+ *        Evicted assets are reloaded the next time they are accessed through Resolve. Assets are only gathered and
+ *        sorted when over budget, in memory taken from scratch (e.g. the frame arena).
+ */
+ResidencyStatus Evict(
+  Collection& collection,
+  const ResidencyOptions& options,
+  const Resources& resources,
+  std::pmr::memory_resource* scratch = std::pmr::get_default_resource());
+
+/**
+ * @brief Returns a pointer to a referenced asset and marks it as used
+ *
+ *        Every use of a resident asset (e.g. each draw of a texture) should go through Resolve, so that assets which
+ *        are still in use are never evicted. If the asset was evicted, it is flagged for reload and will become
+ *        available after subsequent Load calls.
+ *
+ * @param registry  registry holding assets, i.e. Collection::registry
+ *
+ * @retval nullptr  if the asset is not currently loaded
+ */
+template <typename AssetT>
+const AssetT* Resolve(Registry& registry, const Reference<AssetT>& reference, const Clock::Time now)
+{
+  if (reference == nullptr or !registry.valid(*reference.id))
+  {
+    return nullptr;
+  }
+  else if (auto* const residency = registry.template try_get<Residency>(*reference.id); residency != nullptr)
+  {
+    residency->last_used = now;
+    return registry.template try_get<AssetT>(*reference.id);
+  }
+  else if (registry.template all_of<Evicted>(*reference.id))
+  {
+    registry.template remove<Evicted>(*reference.id);
+    registry.template emplace_or_replace<Reload>(*reference.id);
+  }
+  return nullptr;
+}
+
+/**
+ * @copydoc Resolve
+ */
+template <typename AssetT>
+const AssetT* Resolve(Collection& collection, const Reference<AssetT>& reference, const Clock::Time now)
+{
+  return Resolve(collection.registry, reference, now);
+}
+
+}  // namespace tyl::engine::asset
@@ -8,6 +8,8 @@
 // C++ Standard Library
 #include <cstdint>
 #include <filesystem>
+#include <memory>
+#include <vector>
 
 // Tyl
 #include <tyl/engine/asset/types_fwd.hpp>
@@ -26,6 +28,8 @@ struct Collection
 {
   /// Registry holding persistent game assets
   Registry registry;
+  /// Mounted packs, searched in order, from which kPacked assets are resolved
+  std::vector<std::shared_ptr<const Pack>> packs;
 };
 
 /**
@@ -46,6 +50,7 @@ enum class LocationType
 {
   kLocal,
   kRemote,
+  kPacked,
 };
 
 /**
@@ -53,7 +58,7 @@ enum class LocationType
  */
 template <typename AssetT> struct Location
 {
-  /// Path to asset
+  /// Path to asset; for kPacked assets, the path relative to the root directory from which the pack was created
   std::filesystem::path path;
   /// Type of asset location
   LocationType type = LocationType::kLocal;
@@ -74,6 +79,35 @@ struct Info
   std::uintmax_t size_in_bytes = 0;
   /// File type from which asset was loaded
   std::filesystem::file_type type = std::filesystem::file_type::none;
+  /// Last modification time of the file from which asset was loaded
+  std::filesystem::file_time_type last_write_time = std::filesystem::file_time_type::min();
 };
 
+/**
+ * @brief Holds residency information about a loaded asset
+ *
+ * @warning only added as a component to assets which are currently resident
+ */
+struct Residency
+{
+  /// Time at which asset was last used
+  Clock::Time last_used = Clock::Time::min();
+  /// Effective size of the asset on device
+  std::uintmax_t device_size_in_bytes = 0;
+};
+
+/**
+ * @brief Tag indicating that an asset was unloaded to stay within a memory budget
+ */
+struct Evicted
+{};
+
+/**
+ * @brief Tag indicating that an asset should be reloaded from its Location
+ *
+ * @note reloaded assets are replaced in place, so existing Reference holders resolve to the new data
+ */
+struct Reload
+{};
+
 }  // namespace tyl::engine::asset
@@ -45,8 +45,16 @@ using Texture = ::tyl::graphics::device::Texture;
 
 struct Collection;
 
+class Pack;
+
 template <typename AssetT> struct Location;
 
 struct Info;
 
+struct Residency;
+
+struct Evicted;
+
+struct Reload;
+
 }  // namespace tyl::engine::asset
@@ -0,0 +1,71 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file watching.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstdint>
+#include <memory>
+
+// Tyl
+#include <tyl/engine/asset/types_fwd.hpp>
+#include <tyl/expected.hpp>
+
+namespace tyl::engine::asset
+{
+
+/**
+ * @brief Error code indicating problems with watcher creation
+ */
+enum class WatcherError
+{
+  kInitializationFailure,
+};
+
+/**
+ * @brief Summary of changes observed during a Watcher update
+ */
+struct WatchStatus
+{
+  /// Number of assets which started being watched
+  std::size_t added = 0;
+
+  /// Number of assets which were flagged for reload
+  std::size_t modified = 0;
+};
+
+/**
+ * @brief Watches asset files for changes so that assets can be reloaded without restarting
+ *
+ *        Files are watched through the directories which contain them, so that edits which replace a file (e.g.
+ *        write to a temporary file, then rename) are also observed. Only assets whose files have changed are flagged
+ *        with Reload; the next call to Load re-runs loading for those assets alone.
+ */
+class Watcher
+{
+public:
+  Watcher(Watcher&& other) = default;
+
+  ~Watcher();
+
+  /**
+   * @brief Starts watching any newly added assets and flags modified assets for reload
+   *
+   * @note does not block; only file events which are already pending are processed
+   */
+  WatchStatus update(Collection& collection);
+
+  /**
+   * @brief Creates a new watcher
+   */
+  [[nodiscard]] static expected<Watcher, WatcherError> create();
+
+private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+  explicit Watcher(std::unique_ptr<Impl>&& impl);
+};
+
+}  // namespace tyl::engine::asset
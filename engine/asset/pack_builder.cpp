@@ -0,0 +1,80 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file pack_builder.cpp
+ */
+
+// C++ Standard Library
+#include <cstdio>
+#include <filesystem>
+#include <vector>
+
+// Tyl
+#include <tyl/engine/asset/pack.hpp>
+
+using namespace tyl::engine::asset;
+
+namespace
+{
+
+const char* to_string(const PackError error)
+{
+  switch (error)
+  {
+  case PackError::kFailedToOpen:
+    return "failed to open pack file";
+  case PackError::kFailedToMap:
+    return "failed to map pack file";
+  case PackError::kInvalidFormat:
+    return "invalid pack file";
+  case PackError::kFailedToRead:
+    return "failed to read asset file";
+  case PackError::kFailedToWrite:
+    return "failed to write pack file";
+  case PackError::kPathCollision:
+    return "asset path listed more than once";
+  }
+  return "unknown error";
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  if (argc < 3)
+  {
+    std::fprintf(stderr, "%s\n", "[ERROR] REQUIRES:   ./pack_builder <packfile> <root> [files...]");
+    return 1;
+  }
+
+  const std::filesystem::path pack_path{argv[1]};
+  const std::filesystem::path root{argv[2]};
+
+  // Pack all regular files under root unless files are listed explicitly
+  std::vector<std::filesystem::path> files;
+  if (argc > 3)
+  {
+    files.assign(argv + 3, argv + argc);
+  }
+  else
+  {
+    for (const auto& entry : std::filesystem::recursive_directory_iterator{root})
+    {
+      if (entry.is_regular_file())
+      {
+        files.push_back(entry.path());
+      }
+    }
+  }
+
+  if (const auto count_or_error = Pack::write(pack_path, root, files); count_or_error.has_value())
+  {
+    std::fprintf(stderr, "[INFO] packed %zu assets into %s\n", count_or_error.value(), pack_path.c_str());
+    return 0;
+  }
+  else
+  {
+    std::fprintf(stderr, "[ERROR] %s\n", to_string(count_or_error.error()));
+    return 1;
+  }
+}
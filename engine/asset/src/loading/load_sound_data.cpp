@@ -1,9 +1,13 @@
 /**
  * @copyright 2023-present Brian Cairl
  *
- * @file load_textures.hpp
+ * @file load_sound_data.cpp
  */
 
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+
 // Tyl
 #include <tyl/audio/device/sound.hpp>
 #include <tyl/audio/host/sound_data.hpp>
@@ -17,25 +21,24 @@
 namespace tyl::engine::asset
 {
 
-void LoadTextures(LoadStatus& status, Collection& collection, Resources& resources)
+void LoadSoundData(LoadStatus& status, Collection& collection, Resources& resources)
 {
   LoadType<Sound, SoundData>(
     status,
-    collection.registry,
+    collection,
     resources,
-    [](const std::filesystem::path& path) -> expected<SoundData, Error> {
-      if (path.extension() != ".wav")
-      {
-        return make_unexpected(Error::kInvalidPath);
-      }
-
-      if (auto sound_or_error = SoundData::load(path.c_str()); sound_or_error.has_value())
+    [](const std::filesystem::path& path) -> bool { return path.extension() == ".wav"; },
+    [](const void* data, const std::size_t len) -> expected<SoundData, Error> {
+      if (auto sound_or_error = SoundData::load(data, len); sound_or_error.has_value())
       {
         return std::move(sound_or_error).value();
       }
       return make_unexpected(Error::kFailedToLoad);
     },
-    [](Registry& registry, EntityID id, SoundData&& sound_data) { registry.emplace<Sound>(id, sound_data.sound()); });
+    [](Registry& registry, EntityID id, SoundData&& sound_data) -> std::uintmax_t {
+      registry.emplace_or_replace<Sound>(id, sound_data.sound());
+      return sound_data.get_buffer_length();
+    });
 }
 
 }  // namespace tyl::engine::asset
\ No newline at end of file
@@ -5,6 +5,8 @@
  */
 // C++ Standard Library
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <numeric>
 
@@ -25,16 +27,21 @@ void LoadTextures(LoadStatus& status, Collection& collection, Resources& resourc
 {
   LoadType<Texture, Image>(
     status,
-    collection.registry,
+    collection,
     resources,
-    [](const std::filesystem::path& path) -> expected<Image, Error> {
-      if (auto image_or_error = Image::load(path); image_or_error.has_value())
+    []([[maybe_unused]] const std::filesystem::path& path) -> bool { return true; },
+    [](const void* data, const std::size_t len) -> expected<Image, Error> {
+      if (auto image_or_error = Image::load(data, len); image_or_error.has_value())
       {
         return std::move(image_or_error).value();
       }
       return make_unexpected(Error::kFailedToLoad);
     },
-    [](Registry& registry, EntityID id, Image&& image) { registry.emplace<Texture>(id, image.texture()); });
+    [](Registry& registry, EntityID id, Image&& image) -> std::uintmax_t {
+      registry.emplace_or_replace<Texture>(id, image.texture());
+      const auto& shape = image.shape();
+      return static_cast<std::uintmax_t>(shape.height) * shape.width * shape.channel_count;
+    });
 }
 
 }  // namespac etyl::engine::asset
\ No newline at end of file
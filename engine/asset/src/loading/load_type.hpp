@@ -5,8 +5,15 @@
  */
 #pragma once
 
+// C++ Standard Library
+#include <filesystem>
+#include <memory>
+#include <utility>
+
 // Tyl
+#include <tyl/async/task.hpp>
 #include <tyl/engine/asset/loading.hpp>
+#include <tyl/engine/asset/pack.hpp>
 #include <tyl/engine/asset/types.hpp>
 #include <tyl/engine/common/resources.hpp>
 #include <tyl/engine/ecs/types.hpp>
@@ -16,72 +23,199 @@ namespace tyl::engine::asset
 {
 
 /**
- * @brief Holds handle to a loading asset or asset error
+ * @brief Tag indicating that an asset is being read or decoded
+ *
+ *        Removed, along with the loaded asset being added, once loading resumes on Resources::main_thread_queue.
+ */
+template <typename AssetT> struct LoadingState
+{};
+
+namespace detail
+{
+
+/**
+ * @brief Reads an asset file, then decodes it on Resources::job_system
  */
-template <typename AssetT> using LoadingState = async::non_blocking_future<expected<AssetT, Error>>;
+template <typename IntermediateAssetT, typename DoLoadFromMemoryT>
+async::Task<expected<IntermediateAssetT, Error>>
+DecodeFromFile(Resources& resources, std::filesystem::path path, DoLoadFromMemoryT load_from_memory)
+{
+  auto contents_or_error = co_await async::read_file(resources.file_reader, std::move(path), resources.job_system);
+  if (!contents_or_error.has_value())
+  {
+    co_return make_unexpected(Error::kFailedToLoad);
+  }
+  co_return load_from_memory(contents_or_error->data(), contents_or_error->size());
+}
 
-template <typename AssetT, typename IntermediateAssetT = AssetT, typename DoLoadFromPathT, typename DoAddToRegistryT>
+/**
+ * @brief Decodes an asset from a mounted pack on Resources::job_system
+ *
+ * @note \c pack is held to keep its mapping alive until decoding completes
+ */
+template <typename IntermediateAssetT, typename DoLoadFromMemoryT>
+async::Task<expected<IntermediateAssetT, Error>> DecodeFromPack(
+  Resources& resources,
+  std::shared_ptr<const Pack> pack,
+  PackData data,
+  DoLoadFromMemoryT load_from_memory)
+{
+  co_await async::schedule_on(resources.job_system);
+  co_return load_from_memory(data.data, data.size);
+}
+
+/**
+ * @brief Waits on an asset to be decoded, then adds it to the registry on the main thread
+ */
+template <typename LoadingStateType, typename IntermediateAssetT, typename DoAddToRegistryT>
+async::Task<void> FinishLoad(
+  Registry& registry,
+  Resources& resources,
+  EntityID id,
+  async::Task<expected<IntermediateAssetT, Error>> decode,
+  DoAddToRegistryT add_to_registry)
+{
+  auto result = co_await std::move(decode);
+  co_await async::schedule_on(resources.main_thread_queue);
+
+  // Asset may have been removed while loading
+  if (!registry.valid(id) or !registry.template all_of<LoadingStateType>(id))
+  {
+    co_return;
+  }
+  else if (result.has_value())
+  {
+    registry.template emplace_or_replace<Residency>(
+      id, resources.now, add_to_registry(registry, id, std::move(result).value()));
+    registry.template remove<Evicted>(id);
+  }
+  else if (auto* const asset_info = registry.template try_get<Info>(id); asset_info != nullptr)
+  {
+    asset_info->error = result.error();
+  }
+  registry.template remove<LoadingStateType>(id);
+}
+
+}  // namespace detail
+
+/**
+ * @brief Loads, or reloads, assets of a particular type
+ *
+ *        Each asset is loaded by a coroutine, which reads the asset file through Resources::file_reader, decodes it on
+ *        Resources::job_system, and then resumes on Resources::main_thread_queue to add the asset to the registry, so
+ *        that device uploads happen on the main thread, and only once the queue is drained; pending assets are never
+ *        polled.
+ *
+ * @param is_valid_path  returns true if a local asset path names a file which can be loaded
+ * @param load_from_memory  loads an intermediate asset from file contents in memory; invoked on the job system
+ * @param add_to_registry  adds (or replaces) an asset from an intermediate asset; returns the asset device size
+ *
+ * @note \c collection and \c resources must outlive all loads in flight
+ */
+template <
+  typename AssetT,
+  typename IntermediateAssetT = AssetT,
+  typename IsValidPathT,
+  typename DoLoadFromMemoryT,
+  typename DoAddToRegistryT>
 void LoadType(
   LoadStatus& status,
-  Registry& registry,
+  Collection& collection,
   Resources& resources,
-  DoLoadFromPathT load_from_path,
+  IsValidPathT is_valid_path,
+  DoLoadFromMemoryT load_from_memory,
   DoAddToRegistryT add_to_registry)
 {
-  using LocationType = Location<AssetT>;
+  using AssetLocationType = Location<AssetT>;
   using LoadingStateType = LoadingState<IntermediateAssetT>;
 
+  auto& registry = collection.registry;
+
+  // Starts a load which finishes on the main thread, once Resources::main_thread_queue is drained
+  const auto start = [&registry, &resources, add_to_registry](EntityID id, auto decode) {
+    registry.template emplace<LoadingStateType>(id);
+    async::spawn(detail::FinishLoad<LoadingStateType, IntermediateAssetT>(
+      registry, resources, id, std::move(decode), add_to_registry));
+  };
+
+  // Dispatches loading of an asset from a mounted pack, or returns Info with an error if the asset could not be found
+  const auto dispatch_packed = [&](EntityID id, const AssetLocationType& asset_location) -> Info {
+    for (const auto& pack : collection.packs)
+    {
+      if (const auto pack_data = pack->find(asset_location.path); !pack_data.has_value())
+      {
+        continue;
+      }
+      else if (pack_data->codec != PackCodec::kRaw)
+      {
+        return Info{resources.now, Error::kFailedToLoad, pack_data->size, std::filesystem::file_type::regular};
+      }
+      else
+      {
+        start(id, detail::DecodeFromPack<IntermediateAssetT>(resources, pack, *pack_data, load_from_memory));
+
+        return Info{
+          resources.now,
+          Error::kNone,
+          pack_data->size,
+          std::filesystem::file_type::regular,
+          pack->last_write_time()};
+      }
+    }
+    return Info{resources.now, Error::kFailedToLocate, std::uintmax_t{0}, std::filesystem::file_type::none};
+  };
+
+  // Dispatches loading of an asset from its location, or returns Info with an error if the asset could not be found
+  const auto dispatch = [&](EntityID id, const AssetLocationType& asset_location) -> Info {
+    if (asset_location.type == LocationType::kPacked)
+    {
+      return dispatch_packed(id, asset_location);
+    }
+    else if (!is_valid_path(asset_location.path))
+    {
+      return Info{resources.now, Error::kInvalidPath, std::uintmax_t{0}, std::filesystem::file_type::none};
+    }
+    else if (!std::filesystem::exists(asset_location.path))
+    {
+      return Info{resources.now, Error::kFailedToLocate, std::uintmax_t{0}, std::filesystem::file_type::none};
+    }
+
+    start(id, detail::DecodeFromFile<IntermediateAssetT>(resources, asset_location.path, load_from_memory));
+
+    return Info{
+      resources.now,
+      Error::kNone,
+      std::filesystem::file_size(asset_location.path),
+      std::filesystem::status(asset_location.path).type(),
+      std::filesystem::last_write_time(asset_location.path)};
+  };
+
   // Assets which have yet to be loaded
   {
-    registry.template view<LocationType>(entt::exclude_t<Info, LoadingStateType>{})
+    registry.template view<AssetLocationType>(entt::exclude_t<Info, LoadingStateType>{})
       .each([&](EntityID id, const auto& asset_location) {
         ++status.total;
-        if (std::filesystem::exists(asset_location.path))
-        {
-          registry.template emplace<Info>(
-            id,
-            resources.now,
-            Error::kNone,
-            std::filesystem::file_size(asset_location.path),
-            std::filesystem::status(asset_location.path).type());
-
-          registry.template emplace<LoadingStateType>(
-            id, async::post(resources.thread_pool, [path = asset_location.path, load_from_path]() {
-              return load_from_path(path);
-            }));
-        }
-        else
-        {
-          registry.template emplace<Info>(
-            id, resources.now, Error::kFailedToLocate, std::uintmax_t{0}, std::filesystem::file_type::none);
-        }
+        registry.template emplace<Info>(id, dispatch(id, asset_location));
       });
   }
 
-  // Assets which are currently loading
+  // Assets which have been flagged for reload (reloads of assets which are currently loading are deferred)
   {
-    registry.template view<LocationType, Info, LoadingStateType>().each(
-      [&](EntityID id, const auto& asset_location, auto& asset_info, auto& asset_loading_state) {
-        ++status.total;
-        if (!asset_loading_state.valid())
-        {
-          return;
-        }
-        else if (auto asset_or_error = std::move(asset_loading_state.get()); asset_or_error.has_value())
-        {
-          add_to_registry(registry, id, std::move(asset_or_error).value());
-        }
-        else
-        {
-          asset_info.error = asset_or_error.error();
-        }
-        registry.template remove<LoadingStateType>(id);
+    registry.template view<AssetLocationType, Info, Reload>(entt::exclude_t<LoadingStateType>{})
+      .each([&](EntityID id, const auto& asset_location, auto& asset_info) {
+        asset_info = dispatch(id, asset_location);
+        registry.template remove<Reload>(id);
       });
   }
 
+  // Assets which are currently being read or decoded; these are finished by completions on the main thread queue
+  {
+    status.total += registry.template view<LoadingStateType>().size();
+  }
+
   // Assets which have already been loaded
   {
-    registry.template view<LocationType, Info>(entt::exclude_t<LoadingStateType>{})
+    registry.template view<AssetLocationType, Info>(entt::exclude_t<LoadingStateType>{})
       .each([&](EntityID id, const auto& asset_location, const auto& asset_info) {
         ++status.total;
         if (asset_info.error == Error::kNone)
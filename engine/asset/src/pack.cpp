@@ -0,0 +1,310 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file pack.cpp
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+
+// Linux
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Tyl
+#include <tyl/engine/asset/pack.hpp>
+
+namespace tyl::engine::asset
+{
+namespace
+{
+
+/// Identifies file as a pack
+static constexpr char kPackMagic[4] = {'T', 'Y', 'L', 'P'};
+
+/// Current pack format version; version 2 added asset paths, so that colliding path hashes are told apart
+static constexpr std::uint32_t kPackVersion = 2;
+
+/// Alignment of asset payloads within a pack
+static constexpr std::uint64_t kPayloadAlignment = alignof(std::max_align_t);
+
+static_assert(sizeof(PackHeader) == 16, "PackHeader layout must not depend on compiler padding");
+static_assert(sizeof(PackEntry) == 40, "PackEntry layout must not depend on compiler padding");
+
+constexpr std::uint64_t align_up(const std::uint64_t offset)
+{
+  return (offset + kPayloadAlignment - 1) & ~(kPayloadAlignment - 1);
+}
+
+template <typename T, typename D> std::unique_ptr<T, D> make_file_uptr(T* p, D deleter)
+{
+  return {p, std::move(deleter)};
+}
+
+/// Returns the form of a path which is stored in, and hashed for, a pack
+std::string to_pack_path(const std::filesystem::path& path) { return path.lexically_normal().generic_string(); }
+
+}  // namespace
+
+std::uint64_t PackPathHash(const std::filesystem::path& path)
+{
+  // 64-bit FNV-1a over the normalized, platform-independent form of the path
+  static constexpr std::uint64_t kFNVOffsetBasis = 14695981039346656037ULL;
+  static constexpr std::uint64_t kFNVPrime = 1099511628211ULL;
+
+  std::uint64_t hash = kFNVOffsetBasis;
+  for (const char c : to_pack_path(path))
+  {
+    hash ^= static_cast<std::uint8_t>(c);
+    hash *= kFNVPrime;
+  }
+  return hash;
+}
+
+Pack::Pack(
+  const std::filesystem::path& path,
+  std::filesystem::file_time_type last_write_time,
+  void* mapped,
+  std::size_t mapped_size) :
+    path_{path},
+    last_write_time_{last_write_time},
+    mapped_{mapped},
+    mapped_size_{mapped_size},
+    entries_{reinterpret_cast<const PackEntry*>(static_cast<const std::uint8_t*>(mapped) + sizeof(PackHeader))},
+    entry_count_{reinterpret_cast<const PackHeader*>(mapped)->entry_count}
+{}
+
+Pack::Pack(Pack&& other) :
+    path_{std::move(other.path_)},
+    last_write_time_{other.last_write_time_},
+    mapped_{other.mapped_},
+    mapped_size_{other.mapped_size_},
+    entries_{other.entries_},
+    entry_count_{other.entry_count_}
+{
+  other.mapped_ = nullptr;
+}
+
+Pack::~Pack()
+{
+  if (mapped_ == nullptr)
+  {
+    return;
+  }
+  ::munmap(mapped_, mapped_size_);
+}
+
+std::optional<PackData> Pack::find(const std::filesystem::path& path) const
+{
+  const std::string pack_path = to_pack_path(path);
+  const std::uint64_t path_hash = PackPathHash(path);
+
+  const auto* const first = entries_;
+  const auto* const last = entries_ + entry_count_;
+  const auto* entry =
+    std::lower_bound(first, last, path_hash, [](const PackEntry& e, std::uint64_t h) { return e.path_hash < h; });
+
+  // Hashes may collide, so paths are compared to tell apart assets, and assets which are not in this pack at all
+  for (; entry != last and entry->path_hash == path_hash; ++entry)
+  {
+    const std::string_view entry_path{static_cast<const char*>(mapped_) + entry->path_offset, entry->path_size};
+    if (entry_path == pack_path)
+    {
+      return PackData{static_cast<const std::uint8_t*>(mapped_) + entry->offset, entry->size, entry->codec};
+    }
+  }
+  return std::nullopt;
+}
+
+expected<Pack, PackError> Pack::open(const std::filesystem::path& path)
+{
+  std::error_code ec;
+  const auto last_write_time = std::filesystem::last_write_time(path, ec);
+  if (ec)
+  {
+    return make_unexpected(PackError::kFailedToOpen);
+  }
+
+  const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0)
+  {
+    return make_unexpected(PackError::kFailedToOpen);
+  }
+
+  struct stat file_stat;
+  if (::fstat(fd, &file_stat) != 0)
+  {
+    ::close(fd);
+    return make_unexpected(PackError::kFailedToOpen);
+  }
+
+  const std::size_t mapped_size = static_cast<std::size_t>(file_stat.st_size);
+  if (mapped_size < sizeof(PackHeader))
+  {
+    ::close(fd);
+    return make_unexpected(PackError::kInvalidFormat);
+  }
+
+  // Mapping remains valid after the descriptor is closed
+  void* const mapped = ::mmap(nullptr, mapped_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (mapped == MAP_FAILED)
+  {
+    return make_unexpected(PackError::kFailedToMap);
+  }
+
+  // Take ownership of mapping before validation so that it is released on error
+  Pack pack{path, last_write_time, mapped, mapped_size};
+
+  const auto* const header = reinterpret_cast<const PackHeader*>(mapped);
+  if (std::memcmp(header->magic, kPackMagic, sizeof(kPackMagic)) != 0 or header->version != kPackVersion)
+  {
+    return make_unexpected(PackError::kInvalidFormat);
+  }
+
+  if (header->entry_count > (mapped_size - sizeof(PackHeader)) / sizeof(PackEntry))
+  {
+    return make_unexpected(PackError::kInvalidFormat);
+  }
+
+  const auto within_mapping = [mapped_size](const std::uint64_t offset, const std::uint64_t size) {
+    return offset <= mapped_size and size <= (mapped_size - offset);
+  };
+
+  for (std::size_t i = 0; i < pack.entry_count_; ++i)
+  {
+    const auto& entry = pack.entries_[i];
+    if (!within_mapping(entry.offset, entry.size) or !within_mapping(entry.path_offset, entry.path_size))
+    {
+      return make_unexpected(PackError::kInvalidFormat);
+    }
+    else if (i > 0 and pack.entries_[i - 1].path_hash > entry.path_hash)
+    {
+      return make_unexpected(PackError::kInvalidFormat);
+    }
+  }
+
+  return pack;
+}
+
+expected<std::size_t, PackError> Pack::write(
+  const std::filesystem::path& pack_path,
+  const std::filesystem::path& root,
+  const std::vector<std::filesystem::path>& files)
+{
+  // Build table of contents
+  std::vector<PackEntry> entries;
+  std::vector<const std::filesystem::path*> entry_files;
+  std::string paths;
+  {
+    struct Listed
+    {
+      std::uint64_t path_hash;
+      std::string path;
+      const std::filesystem::path* file;
+    };
+
+    std::vector<Listed> listed;
+    listed.reserve(files.size());
+    for (const auto& file : files)
+    {
+      const auto relative = file.lexically_relative(root);
+      listed.push_back({PackPathHash(relative), to_pack_path(relative), &file});
+    }
+
+    std::sort(listed.begin(), listed.end(), [](const Listed& lhs, const Listed& rhs) {
+      return std::tie(lhs.path_hash, lhs.path) < std::tie(rhs.path_hash, rhs.path);
+    });
+
+    // Paths which only share a hash are fine, but the same path cannot be added twice
+    if (std::adjacent_find(listed.begin(), listed.end(), [](const Listed& lhs, const Listed& rhs) {
+          return lhs.path == rhs.path;
+        }) != listed.end())
+    {
+      return make_unexpected(PackError::kPathCollision);
+    }
+
+    const std::uint64_t paths_offset = sizeof(PackHeader) + sizeof(PackEntry) * listed.size();
+    for (const auto& l : listed)
+    {
+      paths += l.path;
+    }
+
+    std::uint64_t path_offset = paths_offset;
+    std::uint64_t end = paths_offset + paths.size();
+    entries.reserve(listed.size());
+    entry_files.reserve(listed.size());
+    for (const auto& l : listed)
+    {
+      std::error_code ec;
+      const auto size = std::filesystem::file_size(*l.file, ec);
+      if (ec)
+      {
+        return make_unexpected(PackError::kFailedToRead);
+      }
+
+      // Empty payloads are not aligned, so that they never point past the end of the file
+      const std::uint64_t offset = (size == 0) ? end : align_up(end);
+      entries.push_back(PackEntry{
+        l.path_hash, path_offset, offset, size, static_cast<std::uint32_t>(l.path.size()), PackCodec::kRaw});
+      entry_files.push_back(l.file);
+      path_offset += l.path.size();
+      end = offset + size;
+    }
+  }
+
+  auto pack_file = make_file_uptr(std::fopen(pack_path.c_str(), "wb"), [](std::FILE* f) { std::fclose(f); });
+  if (pack_file == nullptr)
+  {
+    return make_unexpected(PackError::kFailedToOpen);
+  }
+
+  // Write header, table of contents and paths
+  PackHeader header;
+  std::memcpy(header.magic, kPackMagic, sizeof(kPackMagic));
+  header.version = kPackVersion;
+  header.entry_count = entries.size();
+
+  if (
+    std::fwrite(&header, sizeof(PackHeader), 1, pack_file.get()) != 1 or
+    std::fwrite(entries.data(), sizeof(PackEntry), entries.size(), pack_file.get()) != entries.size() or
+    std::fwrite(paths.data(), 1, paths.size(), pack_file.get()) != paths.size())
+  {
+    return make_unexpected(PackError::kFailedToWrite);
+  }
+
+  // Write payloads
+  std::vector<char> payload;
+  for (std::size_t i = 0; i < entries.size(); ++i)
+  {
+    const auto& entry = entries[i];
+
+    auto asset_file =
+      make_file_uptr(std::fopen(entry_files[i]->c_str(), "rb"), [](std::FILE* f) { std::fclose(f); });
+    payload.resize(entry.size);
+    if (asset_file == nullptr or std::fread(payload.data(), 1, payload.size(), asset_file.get()) != payload.size())
+    {
+      return make_unexpected(PackError::kFailedToRead);
+    }
+
+    if (
+      std::fseek(pack_file.get(), static_cast<long>(entry.offset), SEEK_SET) != 0 or
+      std::fwrite(payload.data(), 1, payload.size(), pack_file.get()) != payload.size())
+    {
+      return make_unexpected(PackError::kFailedToWrite);
+    }
+  }
+
+  return entries.size();
+}
+
+}  // namespace tyl::engine::asset
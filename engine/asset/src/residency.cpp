@@ -0,0 +1,87 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file residency.cpp
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <memory_resource>
+#include <vector>
+
+// Tyl
+#include <tyl/audio/device/sound.hpp>
+#include <tyl/engine/asset/residency.hpp>
+#include <tyl/engine/common/resources.hpp>
+#include <tyl/graphics/device/texture.hpp>
+
+namespace tyl::engine::asset
+{
+namespace
+{
+
+struct ResidentAsset
+{
+  EntityID id;
+  Clock::Time last_used;
+  std::uintmax_t host_size_in_bytes;
+  std::uintmax_t device_size_in_bytes;
+};
+
+}  // namespace
+
+ResidencyStatus Evict(
+  Collection& collection,
+  const ResidencyOptions& options,
+  const Resources& resources,
+  std::pmr::memory_resource* const scratch)
+{
+  auto& registry = collection.registry;
+
+  ResidencyStatus status;
+
+  // Sum sizes of all resident assets; most frames are within budget and need nothing more
+  registry.view<Info, Residency>().each([&status](const auto& info, const auto& residency) {
+    status.host_size_in_bytes += info.size_in_bytes;
+    status.device_size_in_bytes += residency.device_size_in_bytes;
+  });
+
+  if (status.within(options))
+  {
+    return status;
+  }
+
+  // Collect assets which have gone unused long enough to be evicted
+  const auto last_used_cutoff = resources.now - options.min_unused_duration;
+  std::pmr::vector<ResidentAsset> candidates{scratch};
+  registry.view<Info, Residency>().each([&](EntityID id, const auto& info, const auto& residency) {
+    if (residency.last_used <= last_used_cutoff)
+    {
+      candidates.push_back({id, residency.last_used, info.size_in_bytes, residency.device_size_in_bytes});
+    }
+  });
+
+  // Evict least-recently used assets first
+  std::sort(candidates.begin(), candidates.end(), [](const ResidentAsset& lhs, const ResidentAsset& rhs) {
+    return lhs.last_used < rhs.last_used;
+  });
+
+  for (const auto& asset : candidates)
+  {
+    if (status.within(options))
+    {
+      break;
+    }
+
+    registry.remove<Texture, Sound, Residency>(asset.id);
+    registry.emplace<Evicted>(asset.id);
+
+    status.host_size_in_bytes -= asset.host_size_in_bytes;
+    status.device_size_in_bytes -= asset.device_size_in_bytes;
+    ++status.evicted;
+  }
+
+  return status;
+}
+
+}  // namespace tyl::engine::asset
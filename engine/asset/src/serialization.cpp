@@ -9,6 +9,7 @@
 #include <tyl/serialization/file_stream.hpp>
 #include <tyl/serialization/mem_stream.hpp>
 #include <tyl/serialization/named.hpp>
+#include <tyl/serialization/reflect.hpp>
 #include <tyl/serialization/std/chrono.hpp>
 #include <tyl/serialization/std/filesystem.hpp>
 
@@ -37,15 +38,15 @@ template <typename ArchiveT> struct is_trivially_serializable<ArchiveT, Error> :
 template <typename ArchiveT> struct is_trivially_serializable<ArchiveT, Info> : std::true_type
 {};
 
-template <typename ArchiveT, typename AssetT> struct serialize<ArchiveT, Location<AssetT>>
+template <typename AssetT> struct reflect<Location<AssetT>>
 {
-  void operator()(ArchiveT& ar, Location<AssetT>& asset_location)
-  {
-    ar& named{"path", asset_location.path};
-    ar& named{"type", asset_location.type};
-  }
+  static constexpr auto fields = std::make_tuple(TYL_REFLECT_FIELDS(Location<AssetT>, path, type));
 };
 
+template <typename ArchiveT, typename AssetT>
+struct serialize<ArchiveT, Location<AssetT>> : serialize_reflected<ArchiveT, Location<AssetT>>
+{};
+
 template <typename OArchiveT> void save_collection(OArchiveT& oar, const Collection& collection)
 {
   {
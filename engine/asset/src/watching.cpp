@@ -0,0 +1,180 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file watching.cpp
+ */
+
+// C++ Standard Library
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+
+// Linux
+#include <sys/inotify.h>
+#include <unistd.h>
+
+// Tyl
+#include <tyl/engine/asset/types.hpp>
+#include <tyl/engine/asset/watching.hpp>
+#include <tyl/engine/ecs/types.hpp>
+
+namespace tyl::engine::asset
+{
+namespace
+{
+
+/// File events which indicate that the contents of a file have been replaced
+static constexpr std::uint32_t kFileChangedEvents = IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE;
+
+/**
+ * @brief Tag indicating that an asset location is being watched
+ */
+template <typename AssetT> struct Watched
+{};
+
+}  // namespace
+
+class Watcher::Impl
+{
+public:
+  explicit Impl(const int fd) : fd_{fd} {}
+
+  ~Impl() { ::close(fd_); }
+
+  WatchStatus Update(Registry& registry)
+  {
+    WatchStatus status;
+    Add<Texture>(status, registry);
+    Add<Sound>(status, registry);
+    Poll(status, registry);
+    return status;
+  }
+
+private:
+  template <typename AssetT> void Add(WatchStatus& status, Registry& registry)
+  {
+    registry.template view<Location<AssetT>>(entt::exclude_t<Watched<AssetT>>{})
+      .each([&](EntityID id, const auto& asset_location) {
+        registry.template emplace<Watched<AssetT>>(id);
+
+        // Only assets stored as individual local files can be watched
+        if (asset_location.type != LocationType::kLocal)
+        {
+          return;
+        }
+
+        const auto path = std::filesystem::absolute(asset_location.path).lexically_normal();
+        const auto directory = path.parent_path();
+
+        // Watches are per-directory; adding an existing watch returns its original descriptor
+        if (const int wd = ::inotify_add_watch(fd_, directory.c_str(), kFileChangedEvents); wd < 0)
+        {
+          return;
+        }
+        else
+        {
+          directories_[wd] = directory;
+        }
+
+        watched_[path.native()].push_back(id);
+        ++status.added;
+      });
+  }
+
+  void Modified(WatchStatus& status, Registry& registry, const std::filesystem::path& path)
+  {
+    const auto watched_itr = watched_.find(path.native());
+    if (watched_itr == watched_.end())
+    {
+      return;
+    }
+
+    // Assets destroyed since they started being watched are dropped, along with the path once none are left
+    auto& ids = watched_itr->second;
+    std::erase_if(ids, [&registry](const EntityID id) { return !registry.valid(id); });
+    if (ids.empty())
+    {
+      watched_.erase(watched_itr);
+      return;
+    }
+
+    std::error_code ec;
+    const auto last_write_time = std::filesystem::last_write_time(path, ec);
+
+    for (const auto id : ids)
+    {
+      if (!registry.all_of<Info>(id))
+      {
+        continue;
+      }
+
+      // Filter duplicate events for a single change by comparing against the last loaded version of the file
+      if (const auto& info = registry.get<Info>(id); !ec and info.last_write_time == last_write_time)
+      {
+        continue;
+      }
+
+      registry.emplace_or_replace<Reload>(id);
+      ++status.modified;
+    }
+  }
+
+  void Poll(WatchStatus& status, Registry& registry)
+  {
+    alignas(inotify_event) char buffer[4096];
+    while (true)
+    {
+      const ssize_t len = ::read(fd_, buffer, sizeof(buffer));
+      if (len <= 0)
+      {
+        return;
+      }
+
+      for (ssize_t offset = 0; offset < len;)
+      {
+        const auto* const event = reinterpret_cast<const inotify_event*>(buffer + offset);
+        offset += sizeof(inotify_event) + event->len;
+
+        if (event->len == 0 or (event->mask & kFileChangedEvents) == 0)
+        {
+          continue;
+        }
+        else if (const auto directory_itr = directories_.find(event->wd); directory_itr != directories_.end())
+        {
+          Modified(status, registry, directory_itr->second / event->name);
+        }
+      }
+    }
+  }
+
+  /// inotify instance descriptor
+  int fd_;
+
+  /// Watched directories, by watch descriptor
+  std::unordered_map<int, std::filesystem::path> directories_;
+
+  /// Assets associated with each watched file path
+  std::unordered_map<std::string, std::vector<EntityID>> watched_;
+};
+
+Watcher::Watcher(std::unique_ptr<Impl>&& impl) : impl_{std::move(impl)} {}
+
+Watcher::~Watcher() = default;
+
+WatchStatus Watcher::update(Collection& collection) { return impl_->Update(collection.registry); }
+
+expected<Watcher, WatcherError> Watcher::create()
+{
+  if (const int fd = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC); fd < 0)
+  {
+    return make_unexpected(WatcherError::kInitializationFailure);
+  }
+  else
+  {
+    return Watcher{std::make_unique<Impl>(fd)};
+  }
+}
+
+}  // namespace tyl::engine::asset
@@ -0,0 +1,223 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ */
+
+// C++ Standard Library
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Tyl
+#include <tyl/engine/asset/pack.hpp>
+
+using namespace tyl::engine::asset;
+
+namespace
+{
+
+void write_file(const std::filesystem::path& path, std::string_view contents)
+{
+  std::filesystem::create_directories(path.parent_path());
+  std::FILE* file = std::fopen(path.c_str(), "wb");
+  std::fwrite(contents.data(), 1, contents.size(), file);
+  std::fclose(file);
+}
+
+std::string read_file(const std::filesystem::path& path)
+{
+  std::string contents(std::filesystem::file_size(path), '\0');
+  std::FILE* file = std::fopen(path.c_str(), "rb");
+  std::fread(contents.data(), 1, contents.size(), file);
+  std::fclose(file);
+  return contents;
+}
+
+std::string_view to_string_view(const PackData& data)
+{
+  return {static_cast<const char*>(data.data), data.size};
+}
+
+class PackTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    root_ = std::filesystem::absolute("pack_test_assets");
+    std::filesystem::remove_all(root_);
+    write_file(root_ / "textures" / "grass.png", "grass");
+    write_file(root_ / "textures" / "water.png", "water, but longer");
+    write_file(root_ / "sounds" / "step.wav", "");
+  }
+
+  void TearDown() override
+  {
+    std::filesystem::remove_all(root_);
+    std::filesystem::remove(kPackPath);
+  }
+
+  std::vector<std::filesystem::path> files() const
+  {
+    return {root_ / "textures" / "grass.png", root_ / "textures" / "water.png", root_ / "sounds" / "step.wav"};
+  }
+
+  static constexpr const char* kPackPath = "pack_test.pack";
+
+  std::filesystem::path root_;
+};
+
+}  // namespace
+
+TEST_F(PackTest, WriteOpenFind)
+{
+  const auto written_or_error = Pack::write(kPackPath, root_, files());
+  ASSERT_TRUE(written_or_error.has_value());
+  ASSERT_EQ(*written_or_error, 3UL);
+
+  const auto pack_or_error = Pack::open(kPackPath);
+  ASSERT_TRUE(pack_or_error.has_value());
+  ASSERT_EQ(pack_or_error->size(), 3UL);
+
+  const auto grass = pack_or_error->find("textures/grass.png");
+  ASSERT_TRUE(grass.has_value());
+  ASSERT_EQ(grass->codec, PackCodec::kRaw);
+  ASSERT_EQ(to_string_view(*grass), "grass");
+
+  const auto water = pack_or_error->find("textures/water.png");
+  ASSERT_TRUE(water.has_value());
+  ASSERT_EQ(to_string_view(*water), "water, but longer");
+
+  const auto step = pack_or_error->find("sounds/step.wav");
+  ASSERT_TRUE(step.has_value());
+  ASSERT_EQ(step->size, 0UL);
+}
+
+TEST_F(PackTest, FindNormalizesPath)
+{
+  ASSERT_TRUE(Pack::write(kPackPath, root_, files()).has_value());
+
+  const auto pack_or_error = Pack::open(kPackPath);
+  ASSERT_TRUE(pack_or_error.has_value());
+
+  const auto grass = pack_or_error->find("textures/../textures/./grass.png");
+  ASSERT_TRUE(grass.has_value());
+  ASSERT_EQ(to_string_view(*grass), "grass");
+}
+
+TEST_F(PackTest, FindMissing)
+{
+  ASSERT_TRUE(Pack::write(kPackPath, root_, files()).has_value());
+
+  const auto pack_or_error = Pack::open(kPackPath);
+  ASSERT_TRUE(pack_or_error.has_value());
+  ASSERT_FALSE(pack_or_error->find("textures/lava.png").has_value());
+}
+
+TEST_F(PackTest, FindComparesPathWhenHashMatches)
+{
+  ASSERT_TRUE(Pack::write(kPackPath, root_, {root_ / "textures" / "grass.png"}).has_value());
+
+  // Rename the stored path without changing its hash, standing in for a path whose hash collides
+  auto contents = read_file(kPackPath);
+  const auto path_pos = contents.find("textures/grass.png");
+  ASSERT_NE(path_pos, std::string::npos);
+  contents.replace(path_pos, std::strlen("textures/grass.png"), "textures/glass.png");
+  std::filesystem::remove(kPackPath);
+  write_file(std::filesystem::absolute(kPackPath), contents);
+
+  const auto pack_or_error = Pack::open(kPackPath);
+  ASSERT_TRUE(pack_or_error.has_value());
+  ASSERT_FALSE(pack_or_error->find("textures/grass.png").has_value());
+}
+
+TEST_F(PackTest, WriteDuplicatePath)
+{
+  const auto written_or_error =
+    Pack::write(kPackPath, root_, {root_ / "textures" / "grass.png", root_ / "textures" / "." / "grass.png"});
+  ASSERT_FALSE(written_or_error.has_value());
+  ASSERT_EQ(written_or_error.error(), PackError::kPathCollision);
+}
+
+TEST_F(PackTest, WriteMissingFile)
+{
+  const auto written_or_error = Pack::write(kPackPath, root_, {root_ / "textures" / "lava.png"});
+  ASSERT_FALSE(written_or_error.has_value());
+  ASSERT_EQ(written_or_error.error(), PackError::kFailedToRead);
+}
+
+TEST_F(PackTest, OpenMissing)
+{
+  const auto pack_or_error = Pack::open("not-a-pack.pack");
+  ASSERT_FALSE(pack_or_error.has_value());
+  ASSERT_EQ(pack_or_error.error(), PackError::kFailedToOpen);
+}
+
+TEST_F(PackTest, OpenTruncatedHeader)
+{
+  write_file(std::filesystem::absolute(kPackPath), "TYLP");
+
+  const auto pack_or_error = Pack::open(kPackPath);
+  ASSERT_FALSE(pack_or_error.has_value());
+  ASSERT_EQ(pack_or_error.error(), PackError::kInvalidFormat);
+}
+
+TEST_F(PackTest, OpenBadMagic)
+{
+  ASSERT_TRUE(Pack::write(kPackPath, root_, files()).has_value());
+
+  auto contents = read_file(kPackPath);
+  contents[0] = 'X';
+  write_file(std::filesystem::absolute(kPackPath), contents);
+
+  const auto pack_or_error = Pack::open(kPackPath);
+  ASSERT_FALSE(pack_or_error.has_value());
+  ASSERT_EQ(pack_or_error.error(), PackError::kInvalidFormat);
+}
+
+TEST_F(PackTest, OpenTruncatedEntries)
+{
+  ASSERT_TRUE(Pack::write(kPackPath, root_, files()).has_value());
+
+  auto contents = read_file(kPackPath);
+  contents.resize(sizeof(PackHeader) + sizeof(PackEntry));
+  write_file(std::filesystem::absolute(kPackPath), contents);
+
+  const auto pack_or_error = Pack::open(kPackPath);
+  ASSERT_FALSE(pack_or_error.has_value());
+  ASSERT_EQ(pack_or_error.error(), PackError::kInvalidFormat);
+}
+
+TEST_F(PackTest, OpenTruncatedPayload)
+{
+  ASSERT_TRUE(Pack::write(kPackPath, root_, files()).has_value());
+
+  // Drop the last byte of whichever payload comes last in the file
+  auto contents = read_file(kPackPath);
+  contents.pop_back();
+  write_file(std::filesystem::absolute(kPackPath), contents);
+
+  const auto pack_or_error = Pack::open(kPackPath);
+  ASSERT_FALSE(pack_or_error.has_value());
+  ASSERT_EQ(pack_or_error.error(), PackError::kInvalidFormat);
+}
+
+TEST_F(PackTest, OpenPathOutOfRange)
+{
+  ASSERT_TRUE(Pack::write(kPackPath, root_, files()).has_value());
+
+  auto contents = read_file(kPackPath);
+  PackEntry entry;
+  std::memcpy(&entry, contents.data() + sizeof(PackHeader), sizeof(PackEntry));
+  entry.path_offset = contents.size();
+  std::memcpy(contents.data() + sizeof(PackHeader), &entry, sizeof(PackEntry));
+  write_file(std::filesystem::absolute(kPackPath), contents);
+
+  const auto pack_or_error = Pack::open(kPackPath);
+  ASSERT_FALSE(pack_or_error.has_value());
+  ASSERT_EQ(pack_or_error.error(), PackError::kInvalidFormat);
+}
@@ -0,0 +1,125 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ */
+
+// C++ Standard Library
+#include <memory_resource>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Tyl
+#include <tyl/engine/asset/residency.hpp>
+#include <tyl/engine/asset/types.hpp>
+#include <tyl/engine/common/resources.hpp>
+
+using tyl::Clock;
+using namespace tyl::engine;
+using namespace tyl::engine::asset;
+
+namespace
+{
+
+const Clock::Time kStart = Clock::Time{} + Clock::seconds(100);
+
+struct TestAsset
+{
+  int value = 0;
+};
+
+EntityID add_resident(Collection& collection, std::uintmax_t size_in_bytes, Clock::Time last_used)
+{
+  const auto id = collection.registry.create();
+  collection.registry.emplace<TestAsset>(id);
+  collection.registry.emplace<Info>(id, Info{.size_in_bytes = size_in_bytes});
+  collection.registry.emplace<Residency>(id, Residency{.last_used = last_used, .device_size_in_bytes = size_in_bytes});
+  return id;
+}
+
+}  // namespace
+
+TEST(Resolve, MarksResidentAssetUsed)
+{
+  Collection collection;
+  const auto id = add_resident(collection, 10, kStart);
+
+  const auto* const asset = Resolve(collection, Reference<TestAsset>{id}, kStart + Clock::seconds(5));
+  ASSERT_NE(asset, nullptr);
+  ASSERT_EQ(collection.registry.get<Residency>(id).last_used, kStart + Clock::seconds(5));
+}
+
+TEST(Resolve, FlagsEvictedAssetForReload)
+{
+  Collection collection;
+  const auto id = collection.registry.create();
+  collection.registry.emplace<Evicted>(id);
+
+  ASSERT_EQ(Resolve(collection, Reference<TestAsset>{id}, kStart), nullptr);
+  ASSERT_FALSE(collection.registry.all_of<Evicted>(id));
+  ASSERT_TRUE(collection.registry.all_of<Reload>(id));
+}
+
+TEST(Resolve, NullReference)
+{
+  Collection collection;
+  ASSERT_EQ(Resolve(collection, Reference<TestAsset>{}, kStart), nullptr);
+}
+
+TEST(Evict, WithinBudgetDoesNotAllocate)
+{
+  Collection collection;
+  add_resident(collection, 10, kStart);
+  add_resident(collection, 20, kStart);
+
+  Resources resources;
+  resources.now = kStart + Clock::seconds(10);
+
+  // Any allocation from the null resource throws
+  const ResidencyOptions options{.host_budget_in_bytes = 30, .device_budget_in_bytes = 30};
+  const auto status = Evict(collection, options, resources, std::pmr::null_memory_resource());
+  ASSERT_EQ(status.host_size_in_bytes, 30UL);
+  ASSERT_EQ(status.device_size_in_bytes, 30UL);
+  ASSERT_EQ(status.evicted, 0UL);
+}
+
+TEST(Evict, LeastRecentlyUsedFirst)
+{
+  Collection collection;
+  const auto newest = add_resident(collection, 10, kStart + Clock::seconds(2));
+  const auto oldest = add_resident(collection, 10, kStart);
+  const auto middle = add_resident(collection, 10, kStart + Clock::seconds(1));
+
+  Resources resources;
+  resources.now = kStart + Clock::seconds(10);
+
+  std::pmr::monotonic_buffer_resource scratch;
+  const auto status = Evict(collection, {.host_budget_in_bytes = 15}, resources, &scratch);
+  ASSERT_EQ(status.host_size_in_bytes, 10UL);
+  ASSERT_EQ(status.evicted, 2UL);
+
+  ASSERT_TRUE(collection.registry.all_of<Evicted>(oldest));
+  ASSERT_TRUE(collection.registry.all_of<Evicted>(middle));
+  ASSERT_FALSE(collection.registry.all_of<Evicted>(newest));
+  ASSERT_FALSE(collection.registry.all_of<Residency>(oldest));
+  ASSERT_TRUE(collection.registry.all_of<Residency>(newest));
+}
+
+TEST(Evict, KeepsRecentlyUsed)
+{
+  Collection collection;
+  const auto stale = add_resident(collection, 10, kStart);
+  const auto recent = add_resident(collection, 10, kStart + Clock::seconds(10));
+
+  Resources resources;
+  resources.now = kStart + Clock::seconds(10);
+
+  // Over budget even after evicting everything which may be evicted
+  const auto status =
+    Evict(collection, {.host_budget_in_bytes = 0, .min_unused_duration = Clock::seconds(1)}, resources);
+  ASSERT_FALSE(status.within({.host_budget_in_bytes = 0}));
+  ASSERT_EQ(status.host_size_in_bytes, 10UL);
+  ASSERT_EQ(status.evicted, 1UL);
+
+  ASSERT_TRUE(collection.registry.all_of<Evicted>(stale));
+  ASSERT_TRUE(collection.registry.all_of<Residency>(recent));
+}
@@ -0,0 +1,269 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file event_bus.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace tyl::engine
+{
+
+/**
+ * @brief Type-erased interface to an EventChannel, used by EventBus to flip all channels at once
+ */
+class EventChannelBase
+{
+public:
+  virtual ~EventChannelBase() = default;
+
+  /**
+   * @brief Makes events published since the last flip readable, and drops events which were readable until now
+   */
+  virtual void flip() = 0;
+};
+
+/**
+ * @brief Double-buffered queue of events of one type
+ *
+ *        Events published during one frame are readable, all together and in one contiguous span, during the next.
+ *        Publishing claims a slot with a single atomic increment, so any number of threads may publish at once
+ *        without locking. Events which do not fit in the current buffer are kept aside under a lock, and the buffer
+ *        grows to fit on the next flip, so that steady-state frames never lock or allocate.
+ *
+ * @note \c flip must only be called while no thread is publishing or reading, e.g. between frames
+ */
+template <typename EventT> class EventChannel final : public EventChannelBase
+{
+public:
+  /// Default number of events which may be published per frame before a channel grows
+  static constexpr std::size_t kDefaultCapacity = 256;
+
+  explicit EventChannel(const std::size_t capacity = kDefaultCapacity)
+  {
+    for (auto& buffer : buffers_)
+    {
+      buffer.reserve(std::max<std::size_t>(capacity, 1));
+    }
+  }
+
+  EventChannel(EventChannel&& other) = delete;
+
+  EventChannel& operator=(EventChannel&& other) = delete;
+
+  ~EventChannel() override
+  {
+    // Events published since the last flip are constructed, but not yet counted as readable
+    auto& written = buffers_[write_index_];
+    written.size = std::min(written.claimed.load(std::memory_order_relaxed), written.capacity);
+    for (auto& buffer : buffers_)
+    {
+      buffer.release();
+    }
+  }
+
+  /**
+   * @brief Returns number of events which may be published before the next flip without locking
+   */
+  [[nodiscard]] std::size_t capacity() const { return buffers_[write_index_].capacity; }
+
+  /**
+   * @brief Publishes an event, constructed from \c args, to be read after the next flip; may be called from any thread
+   */
+  template <typename... ArgTs> void publish(ArgTs&&... args)
+  {
+    auto& buffer = buffers_[write_index_];
+    if (const std::size_t index = buffer.claimed.fetch_add(1, std::memory_order_relaxed); index < buffer.capacity)
+    {
+      std::construct_at(buffer.events + index, std::forward<ArgTs>(args)...);
+      return;
+    }
+    std::lock_guard lock{buffer.overflow_mutex};
+    buffer.overflow.emplace_back(std::forward<ArgTs>(args)...);
+  }
+
+  /**
+   * @brief Returns events published before the last flip, in no particular order
+   */
+  [[nodiscard]] std::span<const EventT> events() const
+  {
+    const auto& buffer = buffers_[1 - write_index_];
+    return {buffer.events, buffer.size};
+  }
+
+  void flip() override
+  {
+    auto& read = buffers_[1 - write_index_];
+    read.clear();
+
+    auto& written = buffers_[write_index_];
+    written.size = std::min(written.claimed.load(std::memory_order_relaxed), written.capacity);
+    if (!written.overflow.empty())
+    {
+      const std::size_t grown_capacity = written.size + written.overflow.size();
+      written.grow(grown_capacity);
+      read.reserve(grown_capacity);
+    }
+
+    write_index_ = 1 - write_index_;
+  }
+
+private:
+  /**
+   * @brief Storage for events published during one frame
+   */
+  struct Buffer
+  {
+    /// Storage for up to capacity events; only the first size are constructed once published
+    EventT* events = nullptr;
+    /// Number of events which fit in storage
+    std::size_t capacity = 0;
+    /// Number of slots claimed by publishers, including those which did not fit
+    std::atomic<std::size_t> claimed = 0;
+    /// Number of readable events, set on flip
+    std::size_t size = 0;
+    /// Guards overflow
+    std::mutex overflow_mutex;
+    /// Events which did not fit in storage
+    std::vector<EventT> overflow;
+
+    /// Replaces storage with empty storage for at least \c new_capacity events
+    void reserve(const std::size_t new_capacity)
+    {
+      if (new_capacity <= capacity)
+      {
+        return;
+      }
+      release();
+      events = std::allocator<EventT>{}.allocate(new_capacity);
+      capacity = new_capacity;
+    }
+
+    /// Moves readable and overflowed events into storage for \c new_capacity events
+    void grow(const std::size_t new_capacity)
+    {
+      EventT* const grown = std::allocator<EventT>{}.allocate(new_capacity);
+      std::uninitialized_move(events, events + size, grown);
+      std::uninitialized_move(overflow.begin(), overflow.end(), grown + size);
+      const std::size_t grown_size = size + overflow.size();
+      overflow.clear();
+      release();
+      events = grown;
+      capacity = new_capacity;
+      size = grown_size;
+    }
+
+    /// Destroys readable events, leaving storage in place
+    void clear()
+    {
+      std::destroy(events, events + size);
+      size = 0;
+      claimed.store(0, std::memory_order_relaxed);
+    }
+
+    /// Destroys readable events and frees storage
+    void release()
+    {
+      clear();
+      if (events != nullptr)
+      {
+        std::allocator<EventT>{}.deallocate(events, capacity);
+      }
+      events = nullptr;
+      capacity = 0;
+    }
+  };
+
+  /// Buffers being published to and read from, alternately
+  Buffer buffers_[2];
+
+  /// Index of buffer being published to
+  std::size_t write_index_ = 0;
+};
+
+/**
+ * @brief Typed event channels shared between scripts
+ *
+ *        Lets systems react only to what changed (e.g. to invalidate caches, update spatial indices or trigger sounds)
+ *        rather than polling the whole registry.
+ *
+ * @code{.cpp}
+ *        bus.add<Collision>();
+ *        ...
+ *        bus.publish<Collision>(lhs_id, rhs_id);  // from any script, on any thread
+ *        ...
+ *        bus.flip();  // between frames
+ *        ...
+ *        for (const auto& collision : bus.events<Collision>())
+ *        {
+ *          ...
+ *        }
+ * @endcode
+ *
+ * @note channels must be added before scripts which use them run concurrently
+ */
+class EventBus
+{
+public:
+  /**
+   * @brief Adds a channel for EventT, if there is not one already, and returns it
+   */
+  template <typename EventT>
+  EventChannel<EventT>& add(const std::size_t capacity = EventChannel<EventT>::kDefaultCapacity)
+  {
+    auto& channel = channels_[typeid(EventT)];
+    if (channel == nullptr)
+    {
+      channel = std::make_unique<EventChannel<EventT>>(capacity);
+    }
+    return static_cast<EventChannel<EventT>&>(*channel);
+  }
+
+  /**
+   * @brief Returns channel for EventT
+   *
+   * @throws std::out_of_range  if a channel for EventT was never added
+   */
+  template <typename EventT> [[nodiscard]] EventChannel<EventT>& channel() const
+  {
+    return static_cast<EventChannel<EventT>&>(*channels_.at(typeid(EventT)));
+  }
+
+  /**
+   * @brief Publishes an event of type EventT, constructed from \c args; may be called from any thread
+   */
+  template <typename EventT, typename... ArgTs> void publish(ArgTs&&... args) const
+  {
+    channel<EventT>().publish(std::forward<ArgTs>(args)...);
+  }
+
+  /**
+   * @brief Returns events of type EventT published before the last flip
+   */
+  template <typename EventT> [[nodiscard]] std::span<const EventT> events() const
+  {
+    return channel<EventT>().events();
+  }
+
+  /**
+   * @brief Flips all channels, making events published since the last flip readable; called once between frames
+   */
+  void flip();
+
+private:
+  /// Channels by event type
+  std::unordered_map<std::type_index, std::unique_ptr<EventChannelBase>> channels_;
+};
+
+}  // namespace tyl::engine
@@ -0,0 +1,147 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file frame_loop.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+
+// Tyl
+#include <tyl/engine/common/clock.hpp>
+
+namespace tyl::engine
+{
+
+/**
+ * @brief Options for FrameLoop
+ */
+struct FrameLoopOptions
+{
+  /// Simulated time advanced by each fixed step
+  Clock::Duration step_duration = Clock::microseconds(16'667);
+  /// Most steps run in one frame; time past this is dropped, so that a slow frame cannot cause ever slower frames
+  std::size_t max_steps_per_frame = 5;
+  /// Shortest time between frame starts; zero disables pacing (e.g. when vsync already limits frame rate)
+  Clock::Duration target_frame_duration = Clock::Duration::zero();
+  /// Time before the end of a paced frame spent spin-waiting rather than sleeping, since sleeps tend to overshoot
+  Clock::Duration spin_duration = Clock::microseconds(500);
+};
+
+/**
+ * @brief Work to do in one frame, as determined by FrameLoop::begin_frame
+ */
+struct Frame
+{
+  /// Simulation time before the first step of this frame
+  Clock::Time simulation_time;
+  /// Simulated time advanced by each step
+  Clock::Duration step_duration;
+  /// Number of fixed steps to run
+  std::size_t steps;
+  /// Fraction of a step by which real time is ahead of simulation time, after all steps; for render interpolation
+  float interpolation;
+  /// Real time which was not simulated because max_steps_per_frame was reached
+  Clock::Duration dropped;
+
+  /**
+   * @brief Returns simulation time after \c step_index steps of this frame
+   */
+  [[nodiscard]] Clock::Time step_time(const std::size_t step_index) const
+  {
+    return simulation_time + step_duration * static_cast<Clock::Duration::rep>(step_index + 1);
+  }
+};
+
+/**
+ * @brief Separates fixed-step simulation from variable-rate rendering, and paces frames
+ *
+ *        Real time elapsed between frames is accumulated, and simulated in whole steps of a fixed duration, so that
+ *        simulation results do not depend on frame rate. Time left over is carried to the next frame, and exposed as
+ *        an interpolation factor, so that rendering can blend between the last two simulated states.
+ *
+ * @code{.cpp}
+ *        FrameLoop loop{{.target_frame_duration = Clock::microseconds(16'667)}};
+ *        while (running)
+ *        {
+ *          const auto frame = loop.begin_frame(Clock::now());
+ *          for (std::size_t i = 0; i < frame.steps; ++i)
+ *          {
+ *            simulate(frame.step_duration);
+ *          }
+ *          render(frame.interpolation);
+ *          loop.end_frame();
+ *        }
+ * @endcode
+ */
+class FrameLoop
+{
+public:
+  explicit FrameLoop(const FrameLoopOptions& options = {});
+
+  /**
+   * @brief Starts a frame at \c now, and returns the number of steps to simulate
+   *
+   *        The first frame starts the simulation clock, and runs no steps.
+   */
+  Frame begin_frame(Clock::Time now);
+
+  /**
+   * @brief Waits until target_frame_duration has passed since the frame began, if pacing is enabled
+   *
+   *        Sleeps for most of the remaining time, then spin-waits for the last spin_duration, so that frames start on
+   *        time without spinning for the whole wait.
+   */
+  void end_frame() const;
+
+  /**
+   * @brief Returns current simulation time
+   */
+  [[nodiscard]] Clock::Time simulation_time() const { return simulation_time_; }
+
+  /**
+   * @brief Returns options this loop was created with
+   */
+  [[nodiscard]] const FrameLoopOptions& options() const { return options_; }
+
+private:
+  /// Step, cap and pacing configuration
+  FrameLoopOptions options_;
+
+  /// Start of the current frame; Clock::Time::min() before the first frame
+  Clock::Time frame_start_ = Clock::Time::min();
+
+  /// Time simulated so far, in whole steps
+  Clock::Time simulation_time_ = Clock::Time::min();
+
+  /// Real time elapsed but not yet simulated; always less than one step between frames
+  Clock::Duration accumulated_ = Clock::Duration::zero();
+};
+
+/**
+ * @brief Holds the last two simulated values of some rendered state, to be blended by Frame::interpolation
+ */
+template <typename T> struct Interpolated
+{
+  /// Value before the most recent step
+  T previous;
+  /// Value after the most recent step
+  T current;
+
+  /**
+   * @brief Records the value after another step
+   */
+  void push(const T& next)
+  {
+    previous = current;
+    current = next;
+  }
+
+  /**
+   * @brief Returns value blended between previous (at 0) and current (at 1)
+   */
+  [[nodiscard]] T at(const float interpolation) const { return previous + (current - previous) * interpolation; }
+};
+
+}  // namespace tyl::engine
@@ -7,6 +7,9 @@
 
 // Tyl
 #include <tyl/async.hpp>
+#include <tyl/async/file_reader.hpp>
+#include <tyl/async/job_system.hpp>
+#include <tyl/async/main_thread_queue.hpp>
 #include <tyl/engine/common/clock.hpp>
 
 namespace tyl::engine
@@ -14,6 +17,10 @@ namespace tyl::engine
 
 /**
  * @brief Shared execution resources
+ *
+ * @note members are destroyed in reverse order, so in-flight reads and jobs finish, and post their completions, before
+ *       main_thread_queue goes away, which runs those completions; whatever they touch (e.g. the asset registry) must
+ *       outlive these resources
  */
 struct Resources
 {
@@ -22,6 +29,15 @@ struct Resources
 
   /// Thread pool for deferred work execution
   async::ThreadPool thread_pool;
+
+  /// Work to run on the main thread (e.g. graphics and audio device uploads); drained once per frame by the engine loop
+  async::MainThreadQueue main_thread_queue;
+
+  /// Job system for background work which reports back through main_thread_queue
+  async::JobSystem job_system;
+
+  /// Reader for batched, background file reads
+  async::FileReader file_reader;
 };
 
 }  // namespace tyl::engine
@@ -0,0 +1,21 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file event_bus.cpp
+ */
+
+// Tyl
+#include <tyl/engine/common/event_bus.hpp>
+
+namespace tyl::engine
+{
+
+void EventBus::flip()
+{
+  for (auto& [type, channel] : channels_)
+  {
+    channel->flip();
+  }
+}
+
+}  // namespace tyl::engine
@@ -0,0 +1,72 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file frame_loop.cpp
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <thread>
+
+// Tyl
+#include <tyl/engine/common/frame_loop.hpp>
+
+namespace tyl::engine
+{
+
+FrameLoop::FrameLoop(const FrameLoopOptions& options) : options_{options}
+{
+  options_.step_duration = std::max(options_.step_duration, Clock::Duration{1});
+  options_.max_steps_per_frame = std::max<std::size_t>(options_.max_steps_per_frame, 1);
+}
+
+Frame FrameLoop::begin_frame(const Clock::Time now)
+{
+  if (frame_start_ == Clock::Time::min())
+  {
+    frame_start_ = now;
+    simulation_time_ = now;
+    return {simulation_time_, options_.step_duration, 0, 0.f, Clock::Duration::zero()};
+  }
+
+  // Clock may not be monotonic across frames if a caller supplies its own times
+  accumulated_ += std::max(now - frame_start_, Clock::Duration::zero());
+  frame_start_ = now;
+
+  Frame frame{simulation_time_, options_.step_duration, 0, 0.f, Clock::Duration::zero()};
+
+  const auto steps = static_cast<std::size_t>(accumulated_ / options_.step_duration);
+  frame.steps = std::min(steps, options_.max_steps_per_frame);
+  accumulated_ -= options_.step_duration * static_cast<Clock::Duration::rep>(frame.steps);
+
+  // Drop whole steps beyond the cap, but keep the fractional remainder so that interpolation stays smooth
+  if (frame.steps < steps)
+  {
+    frame.dropped = options_.step_duration * static_cast<Clock::Duration::rep>(steps - frame.steps);
+    accumulated_ -= frame.dropped;
+  }
+
+  simulation_time_ += options_.step_duration * static_cast<Clock::Duration::rep>(frame.steps);
+  frame.interpolation = static_cast<float>(accumulated_.count()) / static_cast<float>(options_.step_duration.count());
+  return frame;
+}
+
+void FrameLoop::end_frame() const
+{
+  if (options_.target_frame_duration <= Clock::Duration::zero() or frame_start_ == Clock::Time::min())
+  {
+    return;
+  }
+
+  const auto deadline = frame_start_ + options_.target_frame_duration;
+  if (const auto sleep_until = deadline - options_.spin_duration; Clock::now() < sleep_until)
+  {
+    std::this_thread::sleep_until(sleep_until);
+  }
+  while (Clock::now() < deadline)
+  {
+    std::this_thread::yield();
+  }
+}
+
+}  // namespace tyl::engine
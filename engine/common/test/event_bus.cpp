@@ -0,0 +1,191 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Tyl
+#include <tyl/engine/common/event_bus.hpp>
+
+using namespace tyl::engine;
+
+namespace
+{
+
+/**
+ * @brief Event which counts how many instances are alive
+ */
+struct Tracked
+{
+  static inline std::atomic<int> alive = 0;
+
+  explicit Tracked(const std::size_t _source, const std::size_t _index) : source{_source}, index{_index} { ++alive; }
+
+  Tracked(const Tracked& other) : source{other.source}, index{other.index} { ++alive; }
+
+  Tracked(Tracked&& other) : source{other.source}, index{other.index} { ++alive; }
+
+  Tracked& operator=(const Tracked& other) = default;
+
+  Tracked& operator=(Tracked&& other) = default;
+
+  ~Tracked() { --alive; }
+
+  std::size_t source;
+  std::size_t index;
+};
+
+struct Other
+{
+  int value;
+};
+
+}  // namespace
+
+TEST(EventChannel, EventsVisibleOnlyOnNextFrame)
+{
+  {
+    EventChannel<Tracked> channel{4};
+
+    // Frame N
+    channel.publish(0UL, 0UL);
+    channel.publish(0UL, 1UL);
+    ASSERT_TRUE(channel.events().empty());
+
+    // Frame N + 1
+    channel.flip();
+    ASSERT_EQ(channel.events().size(), 2UL);
+    ASSERT_EQ(channel.events()[0].index, 0UL);
+    ASSERT_EQ(channel.events()[1].index, 1UL);
+    ASSERT_EQ(Tracked::alive, 2);
+
+    // Frame N + 2; events from frame N are destroyed
+    channel.flip();
+    ASSERT_TRUE(channel.events().empty());
+    ASSERT_EQ(Tracked::alive, 0);
+
+    // Destroyed along with the channel, even though they were never read
+    channel.publish(0UL, 2UL);
+    ASSERT_EQ(Tracked::alive, 1);
+  }
+  ASSERT_EQ(Tracked::alive, 0);
+}
+
+TEST(EventChannel, GrowsOnFlipAfterOverflow)
+{
+  {
+    EventChannel<Tracked> channel{2};
+    ASSERT_EQ(channel.capacity(), 2UL);
+
+    for (std::size_t i = 0; i < 5; ++i)
+    {
+      channel.publish(0UL, i);
+    }
+    channel.flip();
+
+    // Overflowed events are gathered with the rest, in one span, and both buffers now fit a frame like that one
+    ASSERT_EQ(channel.events().size(), 5UL);
+    for (std::size_t i = 0; i < 5; ++i)
+    {
+      ASSERT_EQ(channel.events()[i].index, i);
+    }
+    ASSERT_GE(channel.capacity(), 5UL);
+    ASSERT_EQ(Tracked::alive, 5);
+
+    channel.flip();
+    ASSERT_GE(channel.capacity(), 5UL);
+    ASSERT_EQ(Tracked::alive, 0);
+
+    // Overflowed events, never flipped, are destroyed along with the channel
+    for (std::size_t i = 0; i < 10; ++i)
+    {
+      channel.publish(0UL, i);
+    }
+  }
+  ASSERT_EQ(Tracked::alive, 0);
+}
+
+TEST(EventChannel, ConcurrentPublishPastCapacity)
+{
+  static constexpr std::size_t kThreadCount = 8;
+  static constexpr std::size_t kEventsPerThread = 500;
+
+  EventChannel<Tracked> channel{16};
+
+  const auto publish_frame = [&channel] {
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < kThreadCount; ++t)
+    {
+      threads.emplace_back([&channel, t] {
+        for (std::size_t i = 0; i < kEventsPerThread; ++i)
+        {
+          channel.publish(t, i);
+        }
+      });
+    }
+    for (auto& thread : threads)
+    {
+      thread.join();
+    }
+    channel.flip();
+  };
+
+  const auto expect_every_event_once = [&channel] {
+    ASSERT_EQ(channel.events().size(), kThreadCount * kEventsPerThread);
+    std::vector<std::size_t> seen(kThreadCount * kEventsPerThread, 0);
+    for (const auto& event : channel.events())
+    {
+      ++seen[event.source * kEventsPerThread + event.index];
+    }
+    ASSERT_TRUE(std::all_of(seen.begin(), seen.end(), [](const std::size_t count) { return count == 1; }));
+  };
+
+  // Overflows, then fits without overflowing once grown
+  publish_frame();
+  expect_every_event_once();
+  ASSERT_GE(channel.capacity(), kThreadCount * kEventsPerThread);
+
+  publish_frame();
+  expect_every_event_once();
+
+  channel.flip();
+  ASSERT_TRUE(channel.events().empty());
+  ASSERT_EQ(Tracked::alive, 0);
+}
+
+TEST(EventBus, ChannelsFlipTogether)
+{
+  EventBus bus;
+  bus.add<Tracked>();
+  bus.add<Other>();
+
+  bus.publish<Tracked>(0UL, 0UL);
+  bus.publish<Other>(Other{7});
+  ASSERT_TRUE(bus.events<Tracked>().empty());
+  ASSERT_TRUE(bus.events<Other>().empty());
+
+  bus.flip();
+  ASSERT_EQ(bus.events<Tracked>().size(), 1UL);
+  ASSERT_EQ(bus.events<Other>().size(), 1UL);
+  ASSERT_EQ(bus.events<Other>()[0].value, 7);
+
+  bus.flip();
+  ASSERT_TRUE(bus.events<Tracked>().empty());
+  ASSERT_TRUE(bus.events<Other>().empty());
+}
+
+TEST(EventBus, MissingChannel)
+{
+  EventBus bus;
+  ASSERT_THROW(std::ignore = bus.channel<Other>(), std::out_of_range);
+}
@@ -0,0 +1,100 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ */
+
+// GTest
+#include <gtest/gtest.h>
+
+// Tyl
+#include <tyl/engine/common/frame_loop.hpp>
+
+using namespace tyl;
+using namespace tyl::engine;
+
+namespace
+{
+
+const Clock::Time kStart = Clock::Time{} + Clock::seconds(100);
+
+const Clock::Duration kStep = Clock::milliseconds(10);
+
+}  // namespace
+
+TEST(FrameLoop, FirstFrameStartsClock)
+{
+  FrameLoop loop{{.step_duration = kStep}};
+
+  const auto frame = loop.begin_frame(kStart);
+  ASSERT_EQ(frame.steps, 0UL);
+  ASSERT_EQ(frame.interpolation, 0.f);
+  ASSERT_EQ(frame.dropped, Clock::Duration::zero());
+  ASSERT_EQ(frame.simulation_time, kStart);
+  ASSERT_EQ(loop.simulation_time(), kStart);
+}
+
+TEST(FrameLoop, StepsInWholeStepsAndInterpolatesRemainder)
+{
+  FrameLoop loop{{.step_duration = kStep}};
+  loop.begin_frame(kStart);
+
+  const auto frame = loop.begin_frame(kStart + Clock::milliseconds(25));
+  ASSERT_EQ(frame.steps, 2UL);
+  ASSERT_FLOAT_EQ(frame.interpolation, 0.5f);
+  ASSERT_EQ(frame.dropped, Clock::Duration::zero());
+  ASSERT_EQ(frame.simulation_time, kStart);
+  ASSERT_EQ(frame.step_time(0), kStart + kStep);
+  ASSERT_EQ(frame.step_time(1), kStart + 2 * kStep);
+  ASSERT_EQ(loop.simulation_time(), kStart + 2 * kStep);
+}
+
+TEST(FrameLoop, CarriesRemainderToNextFrame)
+{
+  FrameLoop loop{{.step_duration = kStep}};
+  loop.begin_frame(kStart);
+  loop.begin_frame(kStart + Clock::milliseconds(5));
+
+  // 5ms left over from the last frame, plus 5ms from this one, makes one whole step
+  const auto frame = loop.begin_frame(kStart + Clock::milliseconds(10));
+  ASSERT_EQ(frame.steps, 1UL);
+  ASSERT_FLOAT_EQ(frame.interpolation, 0.f);
+  ASSERT_EQ(loop.simulation_time(), kStart + kStep);
+}
+
+TEST(FrameLoop, StepCapDropsWholeSteps)
+{
+  FrameLoop loop{{.step_duration = kStep, .max_steps_per_frame = 3}};
+  loop.begin_frame(kStart);
+
+  const auto frame = loop.begin_frame(kStart + Clock::milliseconds(75));
+  ASSERT_EQ(frame.steps, 3UL);
+  ASSERT_EQ(frame.dropped, 4 * kStep);
+  ASSERT_FLOAT_EQ(frame.interpolation, 0.5f);
+  ASSERT_EQ(loop.simulation_time(), kStart + 3 * kStep);
+
+  // Dropped time is gone for good; only the fractional remainder carries over
+  const auto next_frame = loop.begin_frame(kStart + Clock::milliseconds(80));
+  ASSERT_EQ(next_frame.steps, 1UL);
+  ASSERT_EQ(next_frame.dropped, Clock::Duration::zero());
+  ASSERT_FLOAT_EQ(next_frame.interpolation, 0.f);
+}
+
+TEST(FrameLoop, IgnoresTimeGoingBackwards)
+{
+  FrameLoop loop{{.step_duration = kStep}};
+  loop.begin_frame(kStart);
+
+  const auto frame = loop.begin_frame(kStart - Clock::milliseconds(50));
+  ASSERT_EQ(frame.steps, 0UL);
+  ASSERT_FLOAT_EQ(frame.interpolation, 0.f);
+  ASSERT_EQ(loop.simulation_time(), kStart);
+}
+
+TEST(FrameLoop, EndFramePacesToTarget)
+{
+  FrameLoop loop{{.target_frame_duration = Clock::milliseconds(20)}};
+
+  const auto start = Clock::now();
+  loop.begin_frame(start);
+  loop.end_frame();
+  ASSERT_GE(Clock::now() - start, Clock::milliseconds(20));
+}
@@ -6,14 +6,24 @@
 #pragma once
 
 // C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <string>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 // Tyl
 #include <tyl/ecs.hpp>
 #include <tyl/serialization/named.hpp>
 #include <tyl/serialization/object.hpp>
 #include <tyl/serialization/packet.hpp>
+#include <tyl/serialization/sorted_packet.hpp>
+#include <tyl/serialization/varint.hpp>
 
 namespace tyl::engine
 {
@@ -106,13 +116,129 @@ template <typename ArchiveT, typename ComponentT>
 struct is_trivially_serializable<ArchiveT, Reference<ComponentT>> : std::true_type
 {};
 
+/**
+ * @brief Saves shared payload by value; entities loaded from an archive no longer share payloads
+ */
+template <typename OArchiveT, typename ComponentT> struct save<OArchiveT, Shared<ComponentT>>
+{
+  void operator()(OArchiveT& oar, const Shared<ComponentT>& shared) { oar << named{"value", shared.get()}; }
+};
+
+template <typename IArchiveT, typename ComponentT> struct load<IArchiveT, Shared<ComponentT>>
+{
+  void operator()(IArchiveT& iar, Shared<ComponentT>& shared)
+  {
+    ComponentT value;
+    iar >> named{"value", value};
+    shared = Shared<ComponentT>{std::move(value)};
+  }
+};
+
+/**
+ * @brief Checks if all instances of a component may be serialized at once, as contiguous packets
+ */
+template <typename ArchiveT, typename ComponentT>
+static constexpr bool is_bulk_serializable_v =
+  is_trivially_serializable_v<ArchiveT, ComponentT> and !std::is_empty_v<ComponentT>;
+
+/**
+ * @brief Value which starts every registry archive, followed by kRegistryFormatVersion
+ *
+ *        Registry archives written before the layout was versioned start with their entity count instead, which is
+ *        never this large; those are rejected rather than misread.
+ */
+static constexpr std::uint32_t kRegistryFormatMagic = 0x524C5954;  // "TYLR", little-endian
+
+/**
+ * @brief Version of the registry archive layout, bumped whenever the layout changes
+ *
+ *        Version 1 stores bulk serializable components as a size, a packet of entity IDs in storage order, and one
+ *        packet of values per storage page.
+ */
+static constexpr std::uint32_t kRegistryFormatVersion = 1;
+
+/**
+ * @brief Number of components stored in each page of the component's pool, and in each packet of bulk values
+ */
+template <typename ComponentT>
+static constexpr std::size_t component_page_size_v = entt::component_traits<ComponentT>::page_size;
+
 template <typename IArchive, typename... ComponentTs>
 struct load<IArchive, engine::SerializableRegistry<ComponentTs...>>
 {
   void operator()(IArchive& iar, engine::SerializableRegistry<ComponentTs...> components)
   {
-    SnapshotInputArchive<IArchive> snap_ia{iar, std::addressof(components.registry.get())};
-    entt::snapshot_loader{components.registry.get()}.entities(snap_ia).template component<ComponentTs...>(snap_ia);
+    std::uint32_t magic;
+    iar >> named{"magic", magic};
+    if (magic != kRegistryFormatMagic)
+    {
+      throw std::runtime_error{"Registry archive is unversioned or ill-formed"};
+    }
+
+    std::uint32_t version;
+    iar >> named{"version", version};
+    if (version != kRegistryFormatVersion)
+    {
+      throw std::runtime_error{"Unsupported registry archive version: " + std::to_string(version)};
+    }
+
+    auto& registry = components.registry.get();
+    SnapshotInputArchive<IArchive> snap_ia{iar, std::addressof(registry)};
+    entt::snapshot_loader loader{registry};
+    loader.entities(snap_ia);
+    (load_component<ComponentTs>(iar, snap_ia, loader, registry), ...);
+  }
+
+private:
+  template <typename ComponentT>
+  static void load_component(
+    IArchive& iar,
+    SnapshotInputArchive<IArchive>& snap_ia,
+    entt::snapshot_loader& loader,
+    Registry& registry)
+  {
+    if constexpr (is_bulk_serializable_v<IArchive, ComponentT>)
+    {
+      std::size_t size;
+      iar >> named{"size", size};
+
+      std::vector<EntityID> ids(size);
+      iar >> named{"ids", make_sorted_packet(ids.data(), ids.size())};
+
+      // Snapshot loader requires an empty registry, so components are usually stored in the same order as their IDs
+      auto& storage = registry.template storage<ComponentT>();
+      registry.template insert<ComponentT>(ids.begin(), ids.end());
+
+      constexpr auto kPageSize = component_page_size_v<ComponentT>;
+      if (storage.size() == size and std::equal(ids.begin(), ids.end(), storage.data()))
+      {
+        // Read values straight into the pool, one page at a time
+        for (std::size_t offset = 0; offset < size; offset += kPageSize)
+        {
+          ComponentT* const page = storage.raw()[offset / kPageSize];
+          iar >> named{"values", make_packet(page, std::min(kPageSize, size - offset))};
+        }
+      }
+      else
+      {
+        // Owning groups reorder the pool as components are added, so values are staged a page at a time and placed
+        // by ID instead
+        std::vector<ComponentT> page;
+        for (std::size_t offset = 0; offset < size; offset += kPageSize)
+        {
+          page.resize(std::min(kPageSize, size - offset));
+          iar >> named{"values", make_packet(page.data(), page.size())};
+          for (std::size_t i = 0; i < page.size(); ++i)
+          {
+            storage.get(ids[offset + i]) = std::move(page[i]);
+          }
+        }
+      }
+    }
+    else
+    {
+      loader.template component<ComponentT>(snap_ia);
+    }
   }
 };
 
@@ -121,8 +247,79 @@ struct save<OArchive, engine::ConstSerializableRegistry<ComponentTs...>>
 {
   void operator()(OArchive& oar, engine::ConstSerializableRegistry<ComponentTs...> components)
   {
-    SnapshotOutputArchive<OArchive> snap_oa{oar, std::addressof(components.registry.get())};
-    entt::snapshot{components.registry.get()}.entities(snap_oa).template component<ComponentTs...>(snap_oa);
+    oar << named{"magic", kRegistryFormatMagic};
+    oar << named{"version", kRegistryFormatVersion};
+
+    const auto& registry = components.registry.get();
+    SnapshotOutputArchive<OArchive> snap_oa{oar, std::addressof(registry)};
+    entt::snapshot snapshot{registry};
+    snapshot.entities(snap_oa);
+    (save_component<ComponentTs>(oar, snap_oa, snapshot, registry), ...);
+  }
+
+private:
+  template <typename ComponentT>
+  static void save_component(
+    OArchive& oar,
+    SnapshotOutputArchive<OArchive>& snap_oa,
+    const entt::snapshot& snapshot,
+    const Registry& registry)
+  {
+    if constexpr (is_bulk_serializable_v<OArchive, ComponentT>)
+    {
+      static_assert(
+        !entt::component_traits<ComponentT>::in_place_delete,
+        "Bulk serialized pools must be tightly packed, without tombstones");
+
+      const auto& storage = registry.template storage<ComponentT>();
+      const std::size_t size = storage.size();
+      oar << named{"size", size};
+
+      constexpr auto kPageSize = component_page_size_v<ComponentT>;
+      if constexpr (archive_uses_varints_v<OArchive>)
+      {
+        // Sorted IDs are stored as small differences, so write components in ID order through a sorted index
+        std::vector<std::size_t> order(size);
+        std::iota(order.begin(), order.end(), std::size_t{0});
+        std::sort(order.begin(), order.end(), [ids = storage.data()](const std::size_t lhs, const std::size_t rhs) {
+          return ids[lhs] < ids[rhs];
+        });
+
+        std::vector<EntityID> ids;
+        ids.reserve(size);
+        for (const auto index : order)
+        {
+          ids.push_back(storage.data()[index]);
+        }
+        oar << named{"ids", make_sorted_packet(ids.data(), ids.size())};
+
+        std::vector<ComponentT> page;
+        page.reserve(std::min(kPageSize, size));
+        for (std::size_t offset = 0; offset < size; offset += kPageSize)
+        {
+          page.clear();
+          for (std::size_t i = offset; i < std::min(offset + kPageSize, size); ++i)
+          {
+            page.push_back(storage.raw()[order[i] / kPageSize][order[i] % kPageSize]);
+          }
+          oar << named{"values", make_packet(page.data(), page.size())};
+        }
+      }
+      else
+      {
+        // IDs are packed contiguously; values are paged, so write one packet per page straight from the pool
+        oar << named{"ids", make_sorted_packet(storage.data(), size)};
+        for (std::size_t offset = 0; offset < size; offset += kPageSize)
+        {
+          const ComponentT* const page = storage.raw()[offset / kPageSize];
+          oar << named{"values", make_packet(page, std::min(kPageSize, size - offset))};
+        }
+      }
+    }
+    else
+    {
+      snapshot.template component<ComponentT>(snap_oa);
+    }
   }
 };
 
@@ -16,4 +16,6 @@ using EntityID = tyl::EntityID;
 
 template <typename T> using Reference = tyl::Reference<T>;
 
+template <typename T> using Shared = tyl::Shared<T>;
+
 }  // namespace tyl::engine
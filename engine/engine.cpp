@@ -5,13 +5,27 @@
  */
 
 // C++ Standard Library
+#include <cstddef>
+#include <exception>
 #include <filesystem>
 
 // Tyl
+#include <tyl/engine/asset/loading.hpp>
+#include <tyl/engine/asset/residency.hpp>
+#include <tyl/engine/asset/types.hpp>
+#include <tyl/engine/asset/watching.hpp>
 #include <tyl/engine/assets.hpp>
+#include <tyl/engine/common/frame_loop.hpp>
+#include <tyl/engine/common/resources.hpp>
 #include <tyl/engine/ecs.hpp>
 #include <tyl/engine/scene.hpp>
+#include <tyl/engine/script/perf_monitor.hpp>
+#include <tyl/engine/script/render_pipeline_2D.hpp>
+#include <tyl/engine/script/schedule.hpp>
+#include <tyl/engine/script/script.hpp>
 #include <tyl/engine/window.hpp>
+#include <tyl/frame_arena.hpp>
+#include <tyl/serialization/async_file_ostream.hpp>
 #include <tyl/serialization/binary_archive.hpp>
 #include <tyl/serialization/file_stream.hpp>
 #include <tyl/serialization/named.hpp>
@@ -27,11 +41,13 @@ int main(int argc, char** argv)
     return 1;
   }
 
+  static constexpr bool kEnableVSync = true;
+
   auto window = Window::create(
     {.initial_window_height = 1000,
      .initial_window_width = 1500,
      .window_title = "tyl",
-     .enable_vsync = true,
+     .enable_vsync = kEnableVSync,
      .runtime = {}});
 
   if (!window.has_value())
@@ -40,15 +56,132 @@ int main(int argc, char** argv)
     return 1;
   }
 
-  auto on_update = [&](WindowState& window_state) { return true; };
+  // Simulation runs in fixed steps, independent of frame rate; frames are paced here only if vsync is not doing so
+  FrameLoop frame_loop{
+    {.target_frame_duration = kEnableVSync ? Clock::Duration::zero() : FrameLoopOptions{}.step_duration}};
+
+  // Per-frame transient data; grows to fit the busiest frame seen, after which frames no longer touch the global heap
+  FrameArena frame_arena;
+
+  // Persistent game assets
+  asset::Collection assets;
+
+  // Background execution resources used to load assets; declared after assets, since loads still in flight are run to
+  // completion, adding their assets to the collection, when this is destroyed
+  Resources resources;
+
+  // Flags assets whose files change for reload; the engine still runs, without hot-reloading, if it is unavailable
+  auto asset_watcher = asset::Watcher::create();
+  if (!asset_watcher.has_value())
+  {
+    std::fprintf(stderr, "%s\n", "[WARNING] Failed to create asset watcher; assets will not be reloaded on change.");
+  }
+
+  // Memory budgets for loaded assets; least-recently used assets past these are evicted, and reloaded when next used
+  const asset::ResidencyOptions residency_options{};
+
+  // Active scene, and state shared between the scripts which update it
+  const std::filesystem::path scene_path{argv[1]};
+  Scene scene;
+  ScriptSharedState script_shared_state;
+
+  // A save which cannot be read is left untouched, rather than overwritten by an empty scene on exit
+  if (std::filesystem::exists(scene_path))
+  {
+    try
+    {
+      serialization::file_istream ifs{scene_path};
+      serialization::binary_iarchive iar{ifs};
+      iar >> serialization::named{"scene", scene};
+    }
+    catch (const std::exception& ex)
+    {
+      std::fprintf(stderr, "[ERROR] Failed to load scene from %s: %s\n", scene_path.c_str(), ex.what());
+      return 1;
+    }
+  }
+
+  // Draws the active scene; binds tile map atlases through asset::Resolve, so that assets in view are not evicted
+  auto render_pipeline = RenderPipeline2D::create({.assets = &assets});
+  if (!render_pipeline.has_value())
+  {
+    std::fprintf(stderr, "%s\n", "[ERROR] Failed to create render pipeline.");
+    return 1;
+  }
+
+  auto perf_monitor = PerfMonitor::create({});
+  if (!perf_monitor.has_value())
+  {
+    std::fprintf(stderr, "%s\n", "[ERROR] Failed to create performance monitor.");
+    return 1;
+  }
+
+  // Runs scripts which advance the simulation once per fixed step, running those with non-conflicting scene access at
+  // the same time; simulation results do not depend on frame rate
+  ScriptScheduler step_scheduler;
+
+  // Runs scripts which draw (e.g. GUI and rendering) once per frame, after all of the frame's steps
+  ScriptScheduler frame_scheduler;
+  frame_scheduler.add(*render_pipeline);
+  frame_scheduler.add(*perf_monitor);
+
+  // Steps to simulate this frame, and how far real time is past the last of them
+  Frame frame{};
+
+  // Longest time spent each frame finishing work posted to the main thread (e.g. device uploads for loaded assets)
+  static constexpr auto kMainThreadQueueBudget = Clock::milliseconds(4);
+
+  auto on_update = [&](WindowState& window_state) {
+    resources.now = Clock::now();
+
+    // Loads only finish here, so that device uploads happen on this thread, and never stall a frame for long
+    resources.main_thread_queue.drain(kMainThreadQueueBudget);
+
+    if (asset_watcher.has_value())
+    {
+      asset_watcher->update(assets);
+    }
+    asset::Load(assets, resources);
+    asset::Evict(assets, residency_options, resources, &frame_arena);
+
+    ScriptResources script_resources{
+      .now = resources.now,
+      .interpolation = frame.interpolation,
+      .frame_memory = &frame_arena,
+      .gui_context = window_state.gui_context,
+      .drop_payloads = window_state.drop_payloads,
+      .drop_cursor_position = window_state.drop_cursor_position,
+      .viewport_size = window_state.window_size.cast<float>(),
+      .viewport_cursor_position = window_state.cursor_position,
+      .viewport_cursor_position_normalized = window_state.cursor_position_normalized};
+
+    // Each step sees the simulation time at its end, rather than the real time of the frame
+    for (std::size_t i = 0; i < frame.steps; ++i)
+    {
+      script_resources.now = frame.step_time(i);
+      if (step_scheduler.update(scene, script_shared_state, script_resources) != ScriptStatus::kOk)
+      {
+        return false;
+      }
+    }
+
+    script_resources.now = resources.now;
+    const auto status = frame_scheduler.update(scene, script_shared_state, script_resources);
+
+    // Events published during any of this frame's steps, or by frame scripts, are all read during the next frame
+    script_shared_state.events.flip();
+    return status == ScriptStatus::kOk;
+  };
 
   int retcode = -1;
   while (retcode < 0)
   {
+    frame = frame_loop.begin_frame(Clock::now());
+
     switch (window->update(on_update))
     {
     case WindowStatus::kRunning:
-      continue;
+      break;
     case WindowStatus::kClosing:
       retcode = 0;
       break;
@@ -56,6 +189,32 @@ int main(int argc, char** argv)
       retcode = 1;
       break;
     }
+
+    frame_loop.end_frame();
+    frame_arena.reset();
+  }
+
+  // Scene is serialized while a background thread writes it out; the save is only replaced once all writes succeed
+  if (retcode == 0)
+  {
+    try
+    {
+      serialization::async_file_ostream ofs{scene_path};
+      {
+        serialization::binary_oarchive oar{ofs};
+        oar << serialization::named{"scene", scene};
+      }
+      if (!ofs.close().get())
+      {
+        std::fprintf(stderr, "[ERROR] Failed to write scene to %s\n", scene_path.c_str());
+        retcode = 1;
+      }
+    }
+    catch (const std::exception& ex)
+    {
+      std::fprintf(stderr, "[ERROR] Failed to save scene to %s: %s\n", scene_path.c_str(), ex.what());
+      retcode = 1;
+    }
   }
 
   return retcode;
@@ -1,44 +1,57 @@
 /**
  * @copyright 2023-present Brian Cairl
  *
- * @file camera.hpp
+ * @file drawing.hpp
  */
 #pragma once
 
 // C++ Standard Library
+#include <memory>
+#include <memory_resource>
 #include <vector>
 
 // Tyl
 #include <tyl/engine/math.hpp>
 #include <tyl/serialization/object.hpp>
+#include <tyl/serialization/reflect.hpp>
 #include <tyl/serialization/std/vector.hpp>
 
 namespace tyl::engine
 {
 
-template <typename T> struct DrawingAttributeList
+template <typename T, typename AllocatorT = std::allocator<T>> struct DrawingAttributeList
 {
-  std::vector<T> values;
+  std::vector<T, AllocatorT> values;
 };
 
+namespace pmr
+{
+
+/**
+ * @brief Drawing attributes with storage from a polymorphic memory resource, such as a scene-loading arena
+ */
+template <typename T> using DrawingAttributeList = engine::DrawingAttributeList<T, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+
 struct Color
 {
   Vec4f rgba;
 };
 
-struct ColorList : DrawingAttributeList<Color>
+struct ColorList : pmr::DrawingAttributeList<Color>
 {};
-struct LineList2D : DrawingAttributeList<Vec2f>
+struct LineList2D : pmr::DrawingAttributeList<Vec2f>
 {};
-struct LineList3D : DrawingAttributeList<Vec3f>
+struct LineList3D : pmr::DrawingAttributeList<Vec3f>
 {};
-struct LineStrip2D : DrawingAttributeList<Vec2f>
+struct LineStrip2D : pmr::DrawingAttributeList<Vec2f>
 {};
-struct LineStrip3D : DrawingAttributeList<Vec3f>
+struct LineStrip3D : pmr::DrawingAttributeList<Vec3f>
 {};
-struct Points2D : DrawingAttributeList<Vec2f>
+struct Points2D : pmr::DrawingAttributeList<Vec2f>
 {};
-struct Points3D : DrawingAttributeList<Vec3f>
+struct Points3D : pmr::DrawingAttributeList<Vec3f>
 {};
 
 struct Rect2D : Rect2f
@@ -54,31 +67,37 @@ namespace tyl::serialization
 template <typename ArchiveT> struct is_trivially_serializable<ArchiveT, engine::Color> : std::true_type
 {};
 
-template <typename ArchiveT, typename T> struct serialize<ArchiveT, engine::DrawingAttributeList<T>>
+template <typename T, typename AllocatorT> struct reflect<engine::DrawingAttributeList<T, AllocatorT>>
 {
-  void operator()(ArchiveT& ar, engine::DrawingAttributeList<T>& attrs) { ar& named{"values", attrs.values}; }
+  using list_type = engine::DrawingAttributeList<T, AllocatorT>;
+  static constexpr auto fields = std::make_tuple(TYL_REFLECT_FIELDS(list_type, values));
 };
 
+template <typename ArchiveT, typename T, typename AllocatorT>
+struct serialize<ArchiveT, engine::DrawingAttributeList<T, AllocatorT>>
+    : serialize_reflected<ArchiveT, engine::DrawingAttributeList<T, AllocatorT>>
+{};
+
 template <typename ArchiveT>
-struct serialize<ArchiveT, engine::ColorList> : serialize<ArchiveT, engine::DrawingAttributeList<engine::Color>>
+struct serialize<ArchiveT, engine::ColorList> : serialize<ArchiveT, engine::pmr::DrawingAttributeList<engine::Color>>
 {};
 template <typename ArchiveT>
-struct serialize<ArchiveT, engine::LineList2D> : serialize<ArchiveT, engine::DrawingAttributeList<Vec2f>>
+struct serialize<ArchiveT, engine::LineList2D> : serialize<ArchiveT, engine::pmr::DrawingAttributeList<Vec2f>>
 {};
 template <typename ArchiveT>
-struct serialize<ArchiveT, engine::LineList3D> : serialize<ArchiveT, engine::DrawingAttributeList<Vec3f>>
+struct serialize<ArchiveT, engine::LineList3D> : serialize<ArchiveT, engine::pmr::DrawingAttributeList<Vec3f>>
 {};
 template <typename ArchiveT>
-struct serialize<ArchiveT, engine::LineStrip2D> : serialize<ArchiveT, engine::DrawingAttributeList<Vec2f>>
+struct serialize<ArchiveT, engine::LineStrip2D> : serialize<ArchiveT, engine::pmr::DrawingAttributeList<Vec2f>>
 {};
 template <typename ArchiveT>
-struct serialize<ArchiveT, engine::LineStrip3D> : serialize<ArchiveT, engine::DrawingAttributeList<Vec3f>>
+struct serialize<ArchiveT, engine::LineStrip3D> : serialize<ArchiveT, engine::pmr::DrawingAttributeList<Vec3f>>
 {};
 template <typename ArchiveT>
-struct serialize<ArchiveT, engine::Points2D> : serialize<ArchiveT, engine::DrawingAttributeList<Vec2f>>
+struct serialize<ArchiveT, engine::Points2D> : serialize<ArchiveT, engine::pmr::DrawingAttributeList<Vec2f>>
 {};
 template <typename ArchiveT>
-struct serialize<ArchiveT, engine::Points3D> : serialize<ArchiveT, engine::DrawingAttributeList<Vec3f>>
+struct serialize<ArchiveT, engine::Points3D> : serialize<ArchiveT, engine::pmr::DrawingAttributeList<Vec3f>>
 {};
 
 template <typename ArchiveT> struct is_trivially_serializable<ArchiveT, engine::Rect2D> : std::true_type
@@ -0,0 +1,77 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file render_groups.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <type_traits>
+
+// Tyl
+#include <tyl/ecs.hpp>
+#include <tyl/engine/drawing.hpp>
+#include <tyl/engine/math.hpp>
+#include <tyl/engine/tags.hpp>
+#include <tyl/engine/tile_map.hpp>
+#include <tyl/engine/tile_set.hpp>
+#include <tyl/graphics/device/fwd.hpp>
+
+namespace tyl::engine
+{
+
+/**
+ * @brief Declares owning groups for components which are drawn every frame
+ *
+ *        Owned components are kept packed together at the front of their pools, in the same order across all pools
+ *        in a group, so that drawing is a linear scan over arrays rather than a lookup per component per entity. Each
+ *        component may only be owned by one group, so shared components (e.g. Color) are observed rather than owned.
+ *
+ * @note only the first call on a given registry has any effect
+ */
+void declare_render_groups(Registry& registry);
+
+/**
+ * @brief Returns group of all tile maps, each with its bounding box, tile set and atlas texture
+ *
+ * @note ordered by atlas texture after sort_tile_maps
+ */
+inline auto tile_map_group(Registry& registry)
+{
+  return registry.group<Rect2f, TileMap, Reference<TileSet>, Reference<graphics::device::Texture>>();
+}
+
+/**
+ * @brief Returns group of all visible primitives of type PrimitiveT, with a single Color or per-vertex ColorList
+ *
+ *        Primitives with a single color own PrimitiveT; those with per-vertex colors are the less common case, and are
+ *        gathered by a non-owning group, since PrimitiveT may only be owned once.
+ */
+template <typename PrimitiveT, typename ColorT> auto primitive_group(Registry& registry)
+{
+  if constexpr (std::is_same_v<ColorT, Color>)
+  {
+    return registry.group<PrimitiveT>(entt::get<Color>, entt::exclude<tags::Hidden>);
+  }
+  else
+  {
+    return registry.group<>(entt::get<PrimitiveT, ColorT>, entt::exclude<tags::Hidden>);
+  }
+}
+
+/**
+ * @brief Returns group of all rectangles drawn as outlines
+ */
+inline auto rect_group(Registry& registry) { return registry.group<Rect2D>(entt::get<Color>); }
+
+/**
+ * @brief Orders tile maps by atlas texture, so that each atlas is bound once when tile maps are drawn in order
+ *
+ *        Tile maps which share an atlas are ordered by entity ID, so that draw order is stable. Tile maps are only
+ *        re-sorted if they have been added or retargeted since the last call, which is checked with one linear pass.
+ *
+ * @return true if tile maps were re-sorted
+ */
+bool sort_tile_maps(Registry& registry);
+
+}  // namespace tyl::engine
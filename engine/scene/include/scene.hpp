@@ -6,6 +6,7 @@
 #pragma once
 
 // C++ Standard Library
+#include <memory_resource>
 #include <optional>
 
 // Tyl
@@ -22,6 +23,9 @@ namespace tyl::engine
  */
 struct Scene
 {
+  /// Storage for variable-size components loaded with the scene, released all at once with it, or when another scene
+  /// is loaded in its place; declared first so that it outlives those components
+  std::pmr::synchronized_pool_resource memory;
   /// Registry holding graphics data for the scene
   Registry registry;
   /// ID of the active camera
@@ -38,6 +42,11 @@ template <> struct save<binary_oarchive<file_handle_ostream>, engine::Scene>
   void operator()(binary_oarchive<file_handle_ostream>& ar, const engine::Scene& scene) const;
 };
 
+template <> struct save<binary_oarchive<async_file_ostream>, engine::Scene>
+{
+  void operator()(binary_oarchive<async_file_ostream>& ar, const engine::Scene& scene) const;
+};
+
 template <> struct load<binary_iarchive<file_handle_istream>, engine::Scene>
 {
   void operator()(binary_iarchive<file_handle_istream>& ar, engine::Scene& scene) const;
@@ -13,6 +13,7 @@
 #include <tyl/engine/ecs.hpp>
 #include <tyl/engine/math.hpp>
 #include <tyl/serialization/object.hpp>
+#include <tyl/serialization/reflect.hpp>
 #include <tyl/serialization/std/optional.hpp>
 #include <tyl/serialization/std/vector.hpp>
 
@@ -39,14 +40,8 @@ struct TileMapSection
 namespace tyl::serialization
 {
 
-template <typename ArchiveT> struct serialize<ArchiveT, engine::TileMap>
-{
-  void operator()(ArchiveT& ar, engine::TileMap& tile_set) { ar& named{"sections", tile_set.sections}; }
-};
+TYL_REFLECT(engine::TileMap, sections);
 
-template <typename ArchiveT> struct serialize<ArchiveT, engine::TileMapSection>
-{
-  void operator()(ArchiveT& ar, engine::TileMapSection& tile_set) { ar& named{"tile_indices", tile_set.tile_indices}; }
-};
+TYL_REFLECT(engine::TileMapSection, tile_indices);
 
 }  // namespace tyl::serialization
@@ -11,6 +11,7 @@
 // Tyl
 #include <tyl/engine/math.hpp>
 #include <tyl/serialization/object.hpp>
+#include <tyl/serialization/reflect.hpp>
 #include <tyl/serialization/std/vector.hpp>
 
 namespace tyl::engine
@@ -29,13 +30,6 @@ struct TileSet
 namespace tyl::serialization
 {
 
-template <typename ArchiveT> struct serialize<ArchiveT, engine::TileSet>
-{
-  void operator()(ArchiveT& ar, engine::TileSet& tile_set)
-  {
-    ar& named{"tile_size", tile_set.tile_size};
-    ar& named{"tiles", tile_set.tiles};
-  }
-};
+TYL_REFLECT(engine::TileSet, tile_size, tiles);
 
 }  // namespace tyl::serialization
@@ -0,0 +1,69 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file render_groups.cpp
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <tuple>
+
+// Tyl
+#include <tyl/engine/render_groups.hpp>
+
+namespace tyl::engine
+{
+namespace
+{
+
+/**
+ * @brief Marks render groups as declared in a registry context
+ */
+struct RenderGroupsDeclared
+{};
+
+template <typename PrimitiveT> void declare_primitive_groups(Registry& registry)
+{
+  std::ignore = primitive_group<PrimitiveT, Color>(registry);
+  std::ignore = primitive_group<PrimitiveT, ColorList>(registry);
+}
+
+}  // namespace
+
+void declare_render_groups(Registry& registry)
+{
+  if (registry.ctx().find<RenderGroupsDeclared>() != nullptr)
+  {
+    return;
+  }
+  registry.ctx().emplace<RenderGroupsDeclared>();
+
+  std::ignore = tile_map_group(registry);
+
+  declare_primitive_groups<LineList2D>(registry);
+  declare_primitive_groups<LineStrip2D>(registry);
+  declare_primitive_groups<Points2D>(registry);
+
+  std::ignore = rect_group(registry);
+}
+
+bool sort_tile_maps(Registry& registry)
+{
+  auto group = tile_map_group(registry);
+
+  const auto by_atlas = [&group](const EntityID lhs, const EntityID rhs) {
+    const auto& lhs_atlas = group.get<Reference<graphics::device::Texture>>(lhs);
+    const auto& rhs_atlas = group.get<Reference<graphics::device::Texture>>(rhs);
+    return std::tie(lhs_atlas.id, lhs) < std::tie(rhs_atlas.id, rhs);
+  };
+
+  if (std::is_sorted(group.begin(), group.end(), by_atlas))
+  {
+    return false;
+  }
+
+  group.sort(by_atlas);
+  return true;
+}
+
+}  // namespace tyl::engine
@@ -1,4 +1,5 @@
-// S++ Standard Library
+// C++ Standard Library
+#include <memory_resource>
 #include <string>
 
 // Tyl
@@ -7,22 +8,30 @@
 #include <tyl/engine/ecs.hpp>
 #include <tyl/engine/scene.hpp>
 #include <tyl/engine/tile_map.hpp>
+#include <tyl/serialization/async_file_ostream.hpp>
 #include <tyl/serialization/binary_archive.hpp>
 #include <tyl/serialization/file_stream.hpp>
 #include <tyl/serialization/mem_stream.hpp>
 #include <tyl/serialization/named.hpp>
 #include <tyl/serialization/std/optional.hpp>
+#include <tyl/serialization/std/string.hpp>
 
 namespace tyl::engine
 {
 
 // clang-format off
 using SceneComponents = Components<
-  std::string,
+  std::pmr::string,
   Rect2f,
+  Color,
+  ColorList,
+  LineList2D,
+  LineStrip2D,
+  Points2D,
   TileMap,
   TileMapSection,
-  TopDownCamera2D
+  TopDownCamera2D,
+  Shared<TileMapSection>
 >;
 // clang-format on
 
@@ -42,6 +51,15 @@ template <typename OArchiveT> void save_scene(OArchiveT& oar, const engine::Scen
 
 template <typename IArchiveT> void load_scene(IArchiveT& iar, engine::Scene& scene)
 {
+  // Components from any previous load are destroyed before the pool holding them is released, so that repeated loads
+  // into the same scene do not keep growing it
+  scene.registry = Registry{};
+  scene.active_camera.reset();
+  scene.memory.release();
+
+  // Variable-size components (pmr strings and drawing attributes) are allocated from the scene's own pool;
+  // Eigen-backed tile map data has no allocator hook and still uses the global heap
+  iar.set_memory_resource(&scene.memory);
   {
     engine::serializable_registry_t<engine::SceneComponents> registry{scene.registry};
     iar >> named{"registry", registry};
@@ -56,6 +74,13 @@ void save<binary_oarchive<file_handle_ostream>, engine::Scene>::operator()(
   save_scene(oar, scene);
 }
 
+void save<binary_oarchive<async_file_ostream>, engine::Scene>::operator()(
+  binary_oarchive<async_file_ostream>& oar,
+  const engine::Scene& scene) const
+{
+  save_scene(oar, scene);
+}
+
 void load<binary_iarchive<file_handle_istream>, engine::Scene>::operator()(
   binary_iarchive<file_handle_istream>& iar,
   engine::Scene& scene) const
@@ -25,6 +25,8 @@ struct PerfMonitorOptions
 template <> struct ScriptOptions<PerfMonitor>
 {
   using type = PerfMonitorOptions;
+  using reads = ScriptReads<>;
+  using writes = ScriptWrites<>;
 };
 
 class PerfMonitor : public ScriptBase<PerfMonitor>
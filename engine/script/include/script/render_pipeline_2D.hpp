@@ -13,12 +13,19 @@
 
 namespace tyl::engine
 {
+namespace asset
+{
+struct Collection;
+}  // namespace asset
+
 class RenderPipeline2D;
 
 struct RenderPipeline2DOptions
 {
   const char* name = "Render Pipeline 2D";
   std::size_t max_vertex_count = 10000;
+  /// Assets from which tile map atlases are resolved, marking them as used on each draw; must outlive the pipeline
+  asset::Collection* assets = nullptr;
 };
 
 template <> struct ScriptOptions<RenderPipeline2D>
@@ -0,0 +1,108 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file schedule.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <functional>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+// Tyl
+#include <tyl/ecs.hpp>
+#include <tyl/engine/script/script.hpp>
+
+namespace tyl::engine
+{
+
+/**
+ * @brief Runs a set of scripts once per update, running scripts with non-conflicting scene access concurrently
+ *
+ *        Scripts are ordered as they were added. Each update, a script waits on every earlier script whose scene
+ *        access conflicts with its own (see ScriptAccess::conflicts), and otherwise starts as soon as possible.
+ *        Scripts which are not pinned to the main thread run on ScriptSharedState::thread_pool; the rest run on the
+ *        calling thread while those are in flight. ScriptSharedState::events is not flipped here, since a frame may
+ *        run several updates (e.g. one per fixed step); its owner flips it once all of a frame's updates are done.
+ *
+ * @note scripts are held by reference, and must outlive the scheduler
+ */
+class ScriptScheduler
+{
+public:
+  /**
+   * @brief Adds a script to run after previously added scripts it conflicts with
+   */
+  template <typename ScriptT> void add(ScriptBase<ScriptT>& script)
+  {
+    using OptionsT = ScriptOptions<ScriptT>;
+
+    Entry entry;
+    entry.name = ScriptBase<ScriptT>::name();
+    entry.access = make_script_access<ScriptT>();
+    entry.update = [&script](Scene& scene, ScriptSharedState& shared, const ScriptResources& resources) {
+      return script.update(scene, shared, resources);
+    };
+    if constexpr (detail::script_declares_access<OptionsT>::value)
+    {
+      entry.prepare = [](Registry& registry) {
+        ensure_storages(registry, typename OptionsT::reads{});
+        ensure_storages(registry, typename OptionsT::writes{});
+      };
+    }
+    entries_.push_back(std::move(entry));
+  }
+
+  /**
+   * @brief Updates all scripts, returning once every script has finished
+   *
+   * @return ScriptStatus::kOk, or the status of the last script which did not return ScriptStatus::kOk
+   *
+   * @throws the first exception thrown by a script, once all scripts which had started have finished; scripts which
+   *         had not started by then are skipped
+   */
+  ScriptStatus update(Scene& scene, ScriptSharedState& shared, const ScriptResources& resources);
+
+  /**
+   * @brief Returns number of scheduled scripts
+   */
+  [[nodiscard]] std::size_t size() const { return entries_.size(); }
+
+private:
+  /**
+   * @brief Creates component storages up front, since doing so modifies the registry itself
+   */
+  template <template <typename...> class ListingT, typename... ComponentTs>
+  static void ensure_storages(Registry& registry, ListingT<ComponentTs...>)
+  {
+    (ensure_storage<ComponentTs>(registry), ...);
+  }
+
+  template <typename ComponentT> static void ensure_storage(Registry& registry)
+  {
+    // EntityID stands for entity creation and destruction, rather than a component
+    if constexpr (!std::is_same_v<ComponentT, EntityID>)
+    {
+      registry.template storage<ComponentT>();
+    }
+  }
+
+  struct Entry
+  {
+    /// Script name, for diagnostics
+    std::string_view name;
+    /// Scene access declared by the script
+    ScriptAccess access;
+    /// Prepares scene for concurrent access by the script, if it declared its access
+    std::function<void(Registry&)> prepare;
+    /// Updates the script
+    std::function<ScriptStatus(Scene&, ScriptSharedState&, const ScriptResources&)> update;
+  };
+
+  /// Scheduled scripts, in the order they were added
+  std::vector<Entry> entries_;
+};
+
+}  // namespace tyl::engine
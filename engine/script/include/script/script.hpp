@@ -7,7 +7,10 @@
 
 // C++ Standard Library
 #include <filesystem>
+#include <memory_resource>
 #include <string_view>
+#include <type_traits>
+#include <typeindex>
 #include <vector>
 
 // Tyl
@@ -15,6 +18,7 @@
 #include <tyl/clock.hpp>
 #include <tyl/crtp.hpp>
 #include <tyl/ecs.hpp>
+#include <tyl/engine/common/event_bus.hpp>
 #include <tyl/expected.hpp>
 #include <tyl/rect.hpp>
 #include <tyl/serialization/archive_fwd.hpp>
@@ -31,6 +35,10 @@ struct ScriptResources
 {
   /// Current time
   Clock::Time now = Clock::Time::min();
+  /// Fraction of a fixed simulation step by which real time is ahead of simulation time; see FrameLoop
+  float interpolation = 1.f;
+  /// Memory for data which only lives until the end of the frame (e.g. a FrameArena); may be used from any thread
+  std::pmr::memory_resource* frame_memory = std::pmr::new_delete_resource();
   /// Handle to active engine GUI framework context
   void* gui_context;
   /// Drag-and-drop payloads
@@ -52,6 +60,8 @@ struct ScriptSharedState
 {
   /// Thread pool for deferred work execution
   async::ThreadPool thread_pool;
+  /// Typed events published by scripts, readable by all scripts during the following frame; flipped once per frame
+  EventBus events;
 };
 
 
@@ -83,6 +93,104 @@ template <typename ScriptT> struct ScriptOptions;
 
 template <typename ScriptT> using script_options_t = typename ScriptOptions<ScriptT>::type;
 
+/**
+ * @brief Listing of component types which a script reads
+ */
+template <typename... ComponentTs> struct ScriptReads
+{};
+
+/**
+ * @brief Listing of component types which a script writes, including adding or removing them
+ *
+ *        Scripts which create or destroy entities should list EntityID, which conflicts with any script that reads or
+ *        writes anything in the scene.
+ */
+template <typename... ComponentTs> struct ScriptWrites
+{};
+
+// Scripts may declare how they access a scene through their ScriptOptions specialization, which allows them to be run
+// alongside other scripts on ScriptSharedState::thread_pool:
+//
+// template <> struct ScriptOptions<ScriptT>
+// {
+//   using type = ScriptTOptions;
+//   using reads = ScriptReads<Position, Velocity>;
+//   using writes = ScriptWrites<Position>;
+//   static constexpr bool kMainThreadOnly = false;
+// };
+//
+// Scripts which do not declare reads and writes may access anything in the scene, and never run alongside others.
+// Scripts run on the main thread unless kMainThreadOnly is false; any script using ImGui or the graphics device must
+// leave it unset.
+
+/**
+ * @brief Describes how a script accesses a scene
+ */
+struct ScriptAccess
+{
+  /// Component types read by the script
+  std::vector<std::type_index> reads = {};
+  /// Component types written by the script
+  std::vector<std::type_index> writes = {};
+  /// Indicates that the script did not declare its reads and writes, and may access anything
+  bool exclusive = true;
+  /// Indicates that the script must run on the main thread
+  bool main_thread_only = true;
+
+  /**
+   * @brief Returns true if scripts with these accesses must not run at the same time
+   */
+  [[nodiscard]] bool conflicts(const ScriptAccess& other) const;
+};
+
+namespace detail
+{
+
+template <typename OptionsT, typename = void> struct script_declares_access : std::false_type
+{};
+
+template <typename OptionsT>
+struct script_declares_access<OptionsT, std::void_t<typename OptionsT::reads, typename OptionsT::writes>>
+    : std::true_type
+{};
+
+template <typename OptionsT, typename = void> struct script_main_thread_only : std::true_type
+{};
+
+template <typename OptionsT>
+struct script_main_thread_only<OptionsT, std::void_t<decltype(OptionsT::kMainThreadOnly)>>
+    : std::bool_constant<OptionsT::kMainThreadOnly>
+{};
+
+template <typename... ComponentTs> std::vector<std::type_index> script_component_types(ScriptReads<ComponentTs...>)
+{
+  return {std::type_index{typeid(ComponentTs)}...};
+}
+
+template <typename... ComponentTs> std::vector<std::type_index> script_component_types(ScriptWrites<ComponentTs...>)
+{
+  return {std::type_index{typeid(ComponentTs)}...};
+}
+
+}  // namespace detail
+
+/**
+ * @brief Returns scene access declared by a script through its ScriptOptions specialization
+ */
+template <typename ScriptT> [[nodiscard]] ScriptAccess make_script_access()
+{
+  using OptionsT = ScriptOptions<ScriptT>;
+  ScriptAccess access;
+  if constexpr (detail::script_declares_access<OptionsT>::value)
+  {
+    access.reads = detail::script_component_types(typename OptionsT::reads{});
+    access.writes = detail::script_component_types(typename OptionsT::writes{});
+    access.exclusive = false;
+  }
+  access.main_thread_only = detail::script_main_thread_only<OptionsT>::value;
+  return access;
+}
+
 /**
  * @brief Defines a common script interface
  */
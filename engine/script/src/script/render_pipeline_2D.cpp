@@ -5,13 +5,16 @@
  */
 
 // C++ Standard Library
+#include <optional>
 #include <type_traits>
 
 // Tyl
 #include <tyl/assert.hpp>
+#include <tyl/engine/asset/residency.hpp>
 #include <tyl/engine/camera.hpp>
 #include <tyl/engine/drawing.hpp>
 #include <tyl/engine/math.hpp>
+#include <tyl/engine/render_groups.hpp>
 #include <tyl/engine/scene.hpp>
 #include <tyl/engine/script/render_pipeline_2D.hpp>
 #include <tyl/engine/tags.hpp>
@@ -108,7 +111,7 @@ struct PrimitiveDrawMode<Points2D> : std::integral_constant<VertexBuffer::DrawMo
 template <typename PrimitiveT, typename ColorT, typename SetVertexT>
 std::size_t AddPrimitives(
   PrimitivesVertexBuffer& dvb,
-  const Registry& registry,
+  Registry& registry,
   SetVertexT set_vertex,
   std::size_t vertex_count = 0)
 {
@@ -116,16 +119,15 @@ std::size_t AddPrimitives(
     std::is_same<PrimitiveT, LineStrip2D>() or std::is_same<PrimitiveT, LineStrip3D>();
   static constexpr bool IsSingleColor = std::is_same_v<ColorT, Color>;
 
-  auto view = registry.template view<PrimitiveT, ColorT>(entt::exclude_t<tags::Hidden>{});
+  auto group = primitive_group<PrimitiveT, ColorT>(registry);
   {
     auto mapped = dvb.vb.get_mapped_vertex_buffer();
     auto* const position_ptr = reinterpret_cast<tyl::Vec3f*>(mapped(dvb.position));
     auto* const color_ptr = reinterpret_cast<tyl::Vec4f*>(mapped(dvb.color));
 
-    for (const auto e : view)
+    for (const auto& [id, primitive, vertex_color] : group.each())
     {
-      const auto& vertices = view.template get<PrimitiveT>(e).values;
-      const auto& vertex_color = view.template get<ColorT>(e);
+      const auto& vertices = primitive.values;
 
       // Skip empty vertex lists
       if (vertices.empty())
@@ -182,7 +184,7 @@ std::size_t AddPrimitives(
 template <typename PrimitiveT, typename SetVertexT>
 std::size_t SubmitPrimitives(
   PrimitivesVertexBuffer& dvb,
-  const Registry& registry,
+  Registry& registry,
   SetVertexT&& set_vertex,
   std::size_t vertex_count)
 {
@@ -193,9 +195,9 @@ std::size_t SubmitPrimitives(
   return vertex_count;
 }
 
-std::size_t SubmitRectsAsLineList(PrimitivesVertexBuffer& dvb, const Registry& registry, std::size_t vertex_count)
+std::size_t SubmitRectsAsLineList(PrimitivesVertexBuffer& dvb, Registry& registry, std::size_t vertex_count)
 {
-  auto view = registry.view<Rect2D, Color>();
+  auto group = rect_group(registry);
   {
     auto mapped = dvb.vb.get_mapped_vertex_buffer();
     auto* const position_ptr = reinterpret_cast<tyl::Vec3f*>(mapped(dvb.position));
@@ -208,14 +210,11 @@ std::size_t SubmitRectsAsLineList(PrimitivesVertexBuffer& dvb, const Registry& r
         ++vertex_count;
       };
 
-    for (const auto e : view)
+    for (const auto& [id, rect, color] : group.each())
     {
       static constexpr std::size_t kPoints = 4;
       static constexpr std::size_t kVerticesAdded = 2 * kPoints;
 
-      const auto& rect = view.template get<Rect2D>(e);
-      const auto& color = view.template get<Color>(e);
-
       // Stop adding vertices if we will go past the max vertex count
       if (vertex_count + kVerticesAdded > dvb.max_vertex_count)
       {
@@ -303,7 +302,13 @@ struct SpriteVertexBuffer
   }
 };
 
-void DrawTileMaps(SpriteVertexBuffer& svb, Shader& shader, const Scene& scene, const Rect2f& viewport_rect)
+void DrawTileMaps(
+  SpriteVertexBuffer& svb,
+  Shader& shader,
+  Scene& scene,
+  asset::Collection& assets,
+  const Rect2f& viewport_rect,
+  const Clock::Time now)
 {
   static constexpr std::size_t kSpriteVertexCount = 6;
 
@@ -320,13 +325,13 @@ void DrawTileMaps(SpriteVertexBuffer& svb, Shader& shader, const Scene& scene, c
       ++vertex_count;
     };
 
-  auto tile_map_view = scene.graphics.view<Rect2f, TileMap, Reference<TileSet>, Reference<Texture>>();
-  auto tile_map_section_view = scene.graphics.view<Rect2f, TileMapSection>();
+  // Tile maps are ordered by atlas, so each atlas only needs to be bound once
+  sort_tile_maps(scene.registry);
+  std::optional<EntityID> bound_atlas_texture_id;
 
-  for (const auto tile_map_id : tile_map_view)
+  for (const auto& [tile_map_id, tile_map_bbox, tile_map, tile_set_ref, atlas_texture_ref] :
+       tile_map_group(scene.registry).each())
   {
-    const auto& [tile_map_bbox, tile_map, tile_set_ref, atlas_texture_ref] = tile_map_view.get(tile_map_id);
-
     // Ignore any tile-maps which are fully out of view
     if (disjoint(tile_map_bbox, viewport_rect))
     {
@@ -334,16 +339,27 @@ void DrawTileMaps(SpriteVertexBuffer& svb, Shader& shader, const Scene& scene, c
     }
 
     const auto& tile_size = tile_map.tile_size;
-    const auto& tile_set = resolve(scene.graphics, tile_set_ref);
-    const auto& atlas_texture = resolve(scene.assets, atlas_texture_ref);
+    const auto& tile_set = resolve(scene.registry, tile_set_ref);
 
-    static constexpr std::size_t kSpriteTextureUnit = 0;
+    // Resolving marks the atlas as used, so that it is not evicted while in view; atlases which were evicted are
+    // reloaded, and their tile maps are skipped until then
+    const auto* const atlas_texture = asset::Resolve(assets, atlas_texture_ref, now);
+    if (atlas_texture == nullptr)
+    {
+      continue;
+    }
+    else if (bound_atlas_texture_id != atlas_texture_ref.id)
+    {
+      static constexpr std::size_t kSpriteTextureUnit = 0;
+
+      // Bind texture to an active texture unit
+      atlas_texture->bind(kSpriteTextureUnit);
 
-    // Bind texture to an active texture unit
-    atlas_texture.bind(kSpriteTextureUnit);
+      // Set active texture unit in shader
+      shader.setInt("uAtlasTexture", kSpriteTextureUnit);
 
-    // Set active texture unit in shader
-    shader.setInt("uAtlasTexture", kSpriteTextureUnit);
+      bound_atlas_texture_id = atlas_texture_ref.id;
+    }
 
     for (int s_j = 0; s_j < tile_map.sections.cols(); ++s_j)
     {
@@ -356,7 +372,14 @@ void DrawTileMaps(SpriteVertexBuffer& svb, Shader& shader, const Scene& scene, c
           continue;
         }
 
-        const auto& [section_bbox, section] = tile_map_section_view.get(*section_id_opt);
+        // Sections of instanced tile maps share their tiles with the prefab they were instanced from
+        const auto& section_bbox = scene.registry.get<Rect2f>(*section_id_opt);
+        const auto* const section_ptr = try_get_owned_or_shared<TileMapSection>(scene.registry, *section_id_opt);
+        if (section_ptr == nullptr)
+        {
+          continue;
+        }
+        const auto& section = *section_ptr;
 
         // Ignore any sections which are fully out of view
         if (disjoint(section_bbox, viewport_rect))
@@ -414,23 +437,27 @@ public:
     Shader&& primitives_shader,
     PrimitivesVertexBuffer&& primitives_vb,
     Shader&& sprite_shader,
-    SpriteVertexBuffer&& sprite_vertex_buffer) :
+    SpriteVertexBuffer&& sprite_vertex_buffer,
+    asset::Collection* const assets) :
       primitives_shader_{std::move(primitives_shader)},
       primitives_vb_{std::move(primitives_vb)},
       sprite_shader_{std::move(sprite_shader)},
-      sprite_vb_{std::move(sprite_vertex_buffer)}
+      sprite_vb_{std::move(sprite_vertex_buffer)},
+      assets_{assets}
   {}
 
   void Update(Scene& scene, ScriptSharedState& shared, const ScriptResources& resources)
   {
+    declare_render_groups(scene.registry);
+
     if (!scene.active_camera.has_value())
     {
       return;
     }
 
-    if (scene.graphics.any_of<TopDownCamera2D>(*scene.active_camera))
+    if (scene.registry.any_of<TopDownCamera2D>(*scene.active_camera))
     {
-      const auto& camera = scene.graphics.get<TopDownCamera2D>(*scene.active_camera);
+      const auto& camera = scene.registry.get<TopDownCamera2D>(*scene.active_camera);
       const Mat4f inverse_camera_matrix = ToInverseCameraMatrix(camera);
 
       const Rect2f viewport_rect{
@@ -439,7 +466,7 @@ public:
 
       const Mat4f camera_matrix = inverse_camera_matrix.inverse();
       RenderPrimitives(scene, camera_matrix, viewport_rect);
-      RenderTileMaps(scene, camera_matrix, viewport_rect);
+      RenderTileMaps(scene, camera_matrix, viewport_rect, resources.now);
     };
   }
 
@@ -456,28 +483,34 @@ private:
 
     {
       std::size_t vertex_count = 0;
-      vertex_count = SubmitPrimitives<LineList2D>(primitives_vb_, scene.graphics, SetVertexFrom2D, vertex_count);
-      vertex_count = SubmitRectsAsLineList(primitives_vb_, scene.graphics, vertex_count);
+      vertex_count = SubmitPrimitives<LineList2D>(primitives_vb_, scene.registry, SetVertexFrom2D, vertex_count);
+      vertex_count = SubmitRectsAsLineList(primitives_vb_, scene.registry, vertex_count);
       DrawPrimitives<LineList2D>(primitives_vb_, vertex_count);
     }
     {
       std::size_t vertex_count = 0;
-      vertex_count = SubmitPrimitives<LineStrip2D>(primitives_vb_, scene.graphics, SetVertexFrom2D, vertex_count);
+      vertex_count = SubmitPrimitives<LineStrip2D>(primitives_vb_, scene.registry, SetVertexFrom2D, vertex_count);
       DrawPrimitives<LineStrip2D>(primitives_vb_, vertex_count);
     }
     {
       std::size_t vertex_count = 0;
-      vertex_count = SubmitPrimitives<Points2D>(primitives_vb_, scene.graphics, SetVertexFrom2D, vertex_count);
+      vertex_count = SubmitPrimitives<Points2D>(primitives_vb_, scene.registry, SetVertexFrom2D, vertex_count);
       DrawPrimitives<Points2D>(primitives_vb_, vertex_count);
     }
   }
 
-  void RenderTileMaps(Scene& scene, const Mat4f& camera_matrix, const Rect2f& viewport_rect)
+  void RenderTileMaps(Scene& scene, const Mat4f& camera_matrix, const Rect2f& viewport_rect, const Clock::Time now)
   {
+    // Tile map atlases are assets; without a collection to resolve them from, there is nothing to draw
+    if (assets_ == nullptr)
+    {
+      return;
+    }
+
     sprite_shader_.bind();
     sprite_shader_.setMat4("uCameraTransform", camera_matrix.data());
 
-    DrawTileMaps(sprite_vb_, sprite_shader_, scene, viewport_rect);
+    DrawTileMaps(sprite_vb_, sprite_shader_, scene, *assets_, viewport_rect, now);
   }
 
   Shader primitives_shader_;
@@ -487,6 +520,8 @@ private:
   Shader sprite_shader_;
 
   SpriteVertexBuffer sprite_vb_;
+
+  asset::Collection* assets_;
 };
 
 RenderPipeline2D::~RenderPipeline2D() = default;
@@ -528,12 +563,13 @@ RenderPipeline2D::CreateImpl(const RenderPipeline2DOptions& options)
         std::move(primitives_shader).value(),
         PrimitivesVertexBuffer::create(options.max_vertex_count),
         std::move(sprite_shader).value(),
-        SpriteVertexBuffer::create(options.max_vertex_count))};
+        SpriteVertexBuffer::create(options.max_vertex_count),
+        options.assets)};
   }
 }
 
 RenderPipeline2D::RenderPipeline2D(const RenderPipeline2DOptions& options, std::unique_ptr<Impl>&& impl) :
-    impl_{std::move(impl)}
+    options_{options}, impl_{std::move(impl)}
 {}
 
 template <> void RenderPipeline2D::SaveImpl(ScriptOArchive<file_handle_ostream>& oar) const {}  // impl_->Save(oar); }
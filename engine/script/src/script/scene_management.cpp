@@ -49,7 +49,7 @@ ScriptStatus SceneManagement::UpdateImpl(Scene& scene, ScriptSharedState& shared
       if (ImGui::Button("add"))
       {
         const auto camera = scene.graphics.create();
-        scene.graphics.emplace<std::string>(camera, kCameraLabelBuffer);
+        scene.graphics.emplace<std::pmr::string>(camera, kCameraLabelBuffer);
         scene.graphics.emplace<TopDownCamera2D>(camera, Vec2f{0, 0}, 1.f, resources.viewport_size);
         scene.graphics.emplace<Rect2D>(camera, Vec2f{-1, -1}, Vec2f{1, 1});
         scene.graphics.emplace<Color>(camera, Vec4f{1, 1, 1, 1});
@@ -60,9 +60,9 @@ ScriptStatus SceneManagement::UpdateImpl(Scene& scene, ScriptSharedState& shared
     ImGui::BeginChild("cameras");
     {
       ImGui::Separator();
-      scene.graphics.view<TopDownCamera2D, Rect2D, std::string>().each(
+      scene.graphics.view<TopDownCamera2D, Rect2D, std::pmr::string>().each(
         [&scene, &viewport_size = resources.viewport_size](
-          EntityID id, TopDownCamera2D& camera, Rect2D& camera_rect, const std::string& label) {
+          EntityID id, TopDownCamera2D& camera, Rect2D& camera_rect, const std::pmr::string& label) {
           camera.viewport_size = viewport_size;
 
           ImGui::PushID(static_cast<int>(id));
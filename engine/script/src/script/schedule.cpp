@@ -0,0 +1,186 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file schedule.cpp
+ */
+
+// C++ Standard Library
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory_resource>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+// Tyl
+#include <tyl/async.hpp>
+#include <tyl/engine/scene.hpp>
+#include <tyl/engine/script/schedule.hpp>
+
+namespace tyl::engine
+{
+namespace
+{
+
+/**
+ * @brief Result of a script update
+ */
+struct ScriptResult
+{
+  /// Index of the script
+  std::size_t index;
+  /// Status returned by the script
+  ScriptStatus status;
+  /// Exception thrown by the script, if any
+  std::exception_ptr exception;
+};
+
+}  // namespace
+
+ScriptStatus ScriptScheduler::update(Scene& scene, ScriptSharedState& shared, const ScriptResources& resources)
+{
+  const std::size_t script_count = entries_.size();
+
+  // Scheduling state only lives for this update, so it is all taken from frame memory
+  auto* const memory = resources.frame_memory;
+
+  // Each script waits on earlier scripts it conflicts with, which keeps conflicting scripts in the order they were
+  // added
+  std::pmr::vector<std::size_t> waiting_on(script_count, 0, memory);
+  std::pmr::vector<std::pmr::vector<std::size_t>> dependents(script_count, memory);
+  for (std::size_t i = 0; i < script_count; ++i)
+  {
+    for (std::size_t j = 0; j < i; ++j)
+    {
+      if (entries_[i].access.conflicts(entries_[j].access))
+      {
+        dependents[j].push_back(i);
+        ++waiting_on[i];
+      }
+    }
+  }
+
+  // Storages must exist before scripts touch them concurrently
+  for (const auto& entry : entries_)
+  {
+    if (entry.prepare)
+    {
+      entry.prepare(scene.registry);
+    }
+  }
+
+  // Scripts finished on the thread pool; guarded by mutex, since it is filled from pool threads
+  std::mutex finished_mutex;
+  std::condition_variable finished_cv;
+  std::pmr::vector<ScriptResult> finished{memory};
+
+  std::pmr::vector<async::non_blocking_future<ScriptStatus>> in_flight{memory};
+  std::pmr::deque<std::size_t> main_thread_ready{memory};
+
+  // First exception thrown by a script; only touched on this thread
+  std::exception_ptr error;
+
+  const auto start = [&](const std::size_t i) {
+    // Once a script has thrown, scripts which have not started yet are skipped on this thread
+    if (error != nullptr or entries_[i].access.main_thread_only)
+    {
+      main_thread_ready.push_back(i);
+      return;
+    }
+    in_flight.push_back(async::post(shared.thread_pool, [&, i] {
+      ScriptResult result{i, ScriptStatus::kOk, nullptr};
+      try
+      {
+        result.status = entries_[i].update(scene, shared, resources);
+      }
+      catch (...)
+      {
+        result.exception = std::current_exception();
+      }
+      // Notify while locked, so that the scheduler cannot return before this task is done with its state
+      std::lock_guard lock{finished_mutex};
+      finished.push_back(result);
+      finished_cv.notify_one();
+      return result.status;
+    }));
+  };
+
+  std::size_t finished_count = 0;
+  ScriptStatus update_status = ScriptStatus::kOk;
+
+  const auto finish = [&](const ScriptResult& result) {
+    ++finished_count;
+    if (result.exception != nullptr and error == nullptr)
+    {
+      error = result.exception;
+    }
+    if (result.status != ScriptStatus::kOk)
+    {
+      update_status = result.status;
+    }
+    for (const std::size_t d : dependents[result.index])
+    {
+      if (--waiting_on[d] == 0)
+      {
+        start(d);
+      }
+    }
+  };
+
+  for (std::size_t i = 0; i < script_count; ++i)
+  {
+    if (waiting_on[i] == 0)
+    {
+      start(i);
+    }
+  }
+
+  std::pmr::vector<ScriptResult> newly_finished{memory};
+  while (finished_count < script_count)
+  {
+    {
+      std::unique_lock lock{finished_mutex};
+      if (main_thread_ready.empty())
+      {
+        // Nothing left to do on this thread until a pool script finishes
+        finished_cv.wait(lock, [&finished] { return !finished.empty(); });
+      }
+      newly_finished.swap(finished);
+    }
+
+    for (const auto& result : newly_finished)
+    {
+      finish(result);
+    }
+    newly_finished.clear();
+
+    if (!main_thread_ready.empty())
+    {
+      ScriptResult result{main_thread_ready.front(), ScriptStatus::kOk, nullptr};
+      main_thread_ready.pop_front();
+      if (error == nullptr)
+      {
+        try
+        {
+          result.status = entries_[result.index].update(scene, shared, resources);
+        }
+        catch (...)
+        {
+          result.exception = std::current_exception();
+        }
+      }
+      finish(result);
+    }
+  }
+
+  // Every script which started has finished, so pool tasks no longer refer to this update's state
+  if (error != nullptr)
+  {
+    std::rethrow_exception(error);
+  }
+
+  return update_status;
+}
+
+}  // namespace tyl::engine
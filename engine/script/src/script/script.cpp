@@ -1,3 +1,6 @@
+// C++ Standard Library
+#include <algorithm>
+
 // ImGui
 #include <imgui.h>
 
@@ -6,4 +9,38 @@
 #include <tyl/engine/script/script.hpp>
 
 namespace tyl::engine
-{}  // namespace tyl::engine
+{
+namespace
+{
+
+bool intersects(const std::vector<std::type_index>& lhs, const std::vector<std::type_index>& rhs)
+{
+  return std::any_of(
+    lhs.begin(), lhs.end(), [&rhs](const auto& type) { return std::find(rhs.begin(), rhs.end(), type) != rhs.end(); });
+}
+
+bool touches_scene(const ScriptAccess& access) { return !access.reads.empty() or !access.writes.empty(); }
+
+bool writes_entities(const ScriptAccess& access)
+{
+  const std::type_index entity_type{typeid(EntityID)};
+  return std::find(access.writes.begin(), access.writes.end(), entity_type) != access.writes.end();
+}
+
+}  // namespace
+
+bool ScriptAccess::conflicts(const ScriptAccess& other) const
+{
+  if (exclusive or other.exclusive)
+  {
+    return true;
+  }
+  // Creating or destroying entities touches every component storage, as well as entity validity checks
+  if ((writes_entities(*this) and touches_scene(other)) or (writes_entities(other) and touches_scene(*this)))
+  {
+    return true;
+  }
+  return intersects(writes, other.writes) or intersects(writes, other.reads) or intersects(reads, other.writes);
+}
+
+}  // namespace tyl::engine
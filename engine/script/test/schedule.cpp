@@ -0,0 +1,258 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ */
+
+// C++ Standard Library
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Tyl
+#include <tyl/engine/scene.hpp>
+#include <tyl/engine/script/schedule.hpp>
+
+namespace
+{
+
+struct Position
+{
+  float x = 0;
+};
+
+struct Velocity
+{
+  float x = 0;
+};
+
+struct StepEvent
+{
+  int step = 0;
+};
+
+}  // namespace
+
+namespace tyl::engine
+{
+
+template <typename ReadsT, typename WritesT, bool kMainThread> class TestScript;
+
+struct TestScriptOptions
+{};
+
+template <typename ReadsT, typename WritesT, bool kMainThread>
+struct ScriptOptions<TestScript<ReadsT, WritesT, kMainThread>>
+{
+  using type = TestScriptOptions;
+  using reads = ReadsT;
+  using writes = WritesT;
+  static constexpr bool kMainThreadOnly = kMainThread;
+};
+
+/**
+ * @brief Script which runs a callback on each update
+ */
+template <typename ReadsT, typename WritesT, bool kMainThread = false>
+class TestScript : public ScriptBase<TestScript<ReadsT, WritesT, kMainThread>>
+{
+  friend class ScriptBase<TestScript>;
+
+public:
+  explicit TestScript(std::function<void()> on_update) : on_update_{std::move(on_update)} {}
+
+private:
+  static constexpr std::string_view NameImpl() { return "TestScript"; }
+
+  ScriptStatus UpdateImpl(
+    [[maybe_unused]] Scene& scene,
+    [[maybe_unused]] ScriptSharedState& shared,
+    [[maybe_unused]] const ScriptResources& resources)
+  {
+    on_update_();
+    return ScriptStatus::kOk;
+  }
+
+  std::function<void()> on_update_;
+};
+
+}  // namespace tyl::engine
+
+using namespace tyl;
+using namespace tyl::engine;
+
+TEST(ScriptAccess, EntityWriteConflictsWithAnySceneAccess)
+{
+  const auto spawner = make_script_access<TestScript<ScriptReads<>, ScriptWrites<EntityID>>>();
+  const auto reader = make_script_access<TestScript<ScriptReads<Position>, ScriptWrites<>>>();
+  const auto writer = make_script_access<TestScript<ScriptReads<>, ScriptWrites<Velocity>>>();
+  const auto idle = make_script_access<TestScript<ScriptReads<>, ScriptWrites<>>>();
+
+  ASSERT_TRUE(spawner.conflicts(reader));
+  ASSERT_TRUE(reader.conflicts(spawner));
+  ASSERT_TRUE(spawner.conflicts(writer));
+  ASSERT_TRUE(writer.conflicts(spawner));
+  ASSERT_FALSE(spawner.conflicts(idle));
+  ASSERT_FALSE(reader.conflicts(writer));
+}
+
+TEST(ScriptScheduler, NonConflictingScriptsOverlap)
+{
+  // Each script waits for the other to start, which only happens if both are running at the same time
+  std::atomic<int> started = 0;
+  std::atomic<int> overlapped = 0;
+  const auto rendezvous = [&started, &overlapped] {
+    ++started;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+    while (started.load() < 2 and std::chrono::steady_clock::now() < deadline)
+    {
+      std::this_thread::yield();
+    }
+    if (started.load() == 2)
+    {
+      ++overlapped;
+    }
+  };
+
+  // One script runs on the thread pool and the other on this thread, so a single pool thread is enough to overlap
+  TestScript<ScriptReads<>, ScriptWrites<Position>> position_script{rendezvous};
+  TestScript<ScriptReads<>, ScriptWrites<Velocity>, true> velocity_script{rendezvous};
+
+  ScriptScheduler scheduler;
+  scheduler.add(position_script);
+  scheduler.add(velocity_script);
+
+  Scene scene;
+  ScriptSharedState shared;
+  ASSERT_EQ(scheduler.update(scene, shared, ScriptResources{.gui_context = nullptr}), ScriptStatus::kOk);
+  ASSERT_EQ(overlapped.load(), 2);
+}
+
+TEST(ScriptScheduler, ConflictingScriptsKeepOrder)
+{
+  std::mutex order_mutex;
+  std::vector<int> order;
+  const auto record = [&order_mutex, &order](const int id, const std::chrono::milliseconds delay) {
+    return [&order_mutex, &order, id, delay] {
+      // Earlier scripts finish late, so that running them out of order would show up in the recorded order
+      std::this_thread::sleep_for(delay);
+      std::lock_guard lock{order_mutex};
+      order.push_back(id);
+    };
+  };
+
+  TestScript<ScriptReads<>, ScriptWrites<Position>> writer{record(0, std::chrono::milliseconds{50})};
+  TestScript<ScriptReads<Position>, ScriptWrites<>> reader{record(1, std::chrono::milliseconds{25})};
+  TestScript<ScriptReads<>, ScriptWrites<EntityID>, true> spawner{record(2, std::chrono::milliseconds{0})};
+
+  ScriptScheduler scheduler;
+  scheduler.add(writer);
+  scheduler.add(reader);
+  scheduler.add(spawner);
+  ASSERT_EQ(scheduler.size(), 3UL);
+
+  Scene scene;
+  ScriptSharedState shared;
+  ASSERT_EQ(scheduler.update(scene, shared, ScriptResources{.gui_context = nullptr}), ScriptStatus::kOk);
+  ASSERT_EQ(order, (std::vector<int>{0, 1, 2}));
+}
+
+TEST(ScriptScheduler, PoolScriptExceptionIsRethrown)
+{
+  TestScript<ScriptReads<>, ScriptWrites<Position>> thrower{[] { throw std::runtime_error{"pool script failed"}; }};
+  TestScript<ScriptReads<>, ScriptWrites<Velocity>, true> other{[] {}};
+
+  ScriptScheduler scheduler;
+  scheduler.add(thrower);
+  scheduler.add(other);
+
+  Scene scene;
+  ScriptSharedState shared;
+  ASSERT_THROW(scheduler.update(scene, shared, ScriptResources{.gui_context = nullptr}), std::runtime_error);
+}
+
+TEST(ScriptScheduler, MainThreadExceptionWaitsForPoolScripts)
+{
+  std::atomic<bool> pool_script_done = false;
+  TestScript<ScriptReads<>, ScriptWrites<Position>> pool_script{[&pool_script_done] {
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    pool_script_done = true;
+  }};
+  TestScript<ScriptReads<>, ScriptWrites<Velocity>, true> thrower{[] { throw std::runtime_error{"main failed"}; }};
+
+  ScriptScheduler scheduler;
+  scheduler.add(pool_script);
+  scheduler.add(thrower);
+
+  Scene scene;
+  ScriptSharedState shared;
+  ASSERT_THROW(scheduler.update(scene, shared, ScriptResources{.gui_context = nullptr}), std::runtime_error);
+  ASSERT_TRUE(pool_script_done.load());
+}
+
+TEST(ScriptScheduler, ScriptsAfterExceptionAreSkipped)
+{
+  bool dependent_ran = false;
+  TestScript<ScriptReads<>, ScriptWrites<Position>, true> thrower{[] { throw std::runtime_error{"script failed"}; }};
+  TestScript<ScriptReads<Position>, ScriptWrites<>> dependent{[&dependent_ran] { dependent_ran = true; }};
+
+  ScriptScheduler scheduler;
+  scheduler.add(thrower);
+  scheduler.add(dependent);
+
+  Scene scene;
+  ScriptSharedState shared;
+  ASSERT_THROW(scheduler.update(scene, shared, ScriptResources{.gui_context = nullptr}), std::runtime_error);
+  ASSERT_FALSE(dependent_ran);
+}
+
+TEST(ScriptScheduler, EventsFromEveryStepAreReadNextFrame)
+{
+  Scene scene;
+  ScriptSharedState shared;
+  shared.events.add<StepEvent>();
+
+  int step = 0;
+  TestScript<ScriptReads<>, ScriptWrites<>> publisher{[&shared, &step] { shared.events.publish<StepEvent>(step++); }};
+
+  std::vector<std::vector<int>> frames_read;
+  TestScript<ScriptReads<>, ScriptWrites<>> reader{[&shared, &frames_read] {
+    auto& read = frames_read.emplace_back();
+    for (const auto& event : shared.events.events<StepEvent>())
+    {
+      read.push_back(event.step);
+    }
+  }};
+
+  ScriptScheduler step_scheduler;
+  step_scheduler.add(publisher);
+
+  ScriptScheduler frame_scheduler;
+  frame_scheduler.add(reader);
+
+  // Mirrors the engine loop: a variable number of steps, then frame scripts, then a single flip
+  const auto run_frame = [&](int step_count) {
+    for (int i = 0; i < step_count; ++i)
+    {
+      ASSERT_EQ(step_scheduler.update(scene, shared, ScriptResources{.gui_context = nullptr}), ScriptStatus::kOk);
+    }
+    ASSERT_EQ(frame_scheduler.update(scene, shared, ScriptResources{.gui_context = nullptr}), ScriptStatus::kOk);
+    shared.events.flip();
+  };
+
+  run_frame(3);
+  run_frame(0);
+  run_frame(2);
+  run_frame(1);
+  run_frame(0);
+
+  const std::vector<std::vector<int>> expected{{}, {0, 1, 2}, {}, {3, 4}, {5}};
+  ASSERT_EQ(frames_read, expected);
+}